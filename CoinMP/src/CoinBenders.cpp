@@ -0,0 +1,967 @@
+
+/*  CoinBenders.cpp  */
+
+#include <string.h>
+
+#include "CoinProblem.h"
+#include "CoinResult.h"
+#include "CoinSolver.h"
+#include "CoinOption.h"
+
+#include <cfloat>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "CoinTime.hpp"
+
+#include "ClpSimplex.hpp"
+#include "OsiClpSolverInterface.hpp"
+#include "CbcModel.hpp"
+
+#include "CoinCbc.h"
+#include "CoinBenders.h"
+
+
+#if defined(_WIN32)
+#include <windows.h>
+typedef CRITICAL_SECTION COINMUTEX;
+typedef CONDITION_VARIABLE COINCOND;
+typedef HANDLE COINTHREAD;
+#define coinInitMutex(m)      InitializeCriticalSection(m)
+#define coinDestroyMutex(m)   DeleteCriticalSection(m)
+#define coinLockMutex(m)      EnterCriticalSection(m)
+#define coinUnlockMutex(m)    LeaveCriticalSection(m)
+#define coinInitCond(c)       InitializeConditionVariable(c)
+#define coinDestroyCond(c)
+#define coinWaitCond(c, m)    SleepConditionVariableCS(c, m, INFINITE)
+#define coinWakeAllCond(c)    WakeAllConditionVariable(c)
+#define coinStartThread(t, f, a)  ((*(t) = CreateThread(NULL, 0, f, a, 0, NULL)) != NULL)
+#define coinJoinThread(t)     (WaitForSingleObject(t, INFINITE), CloseHandle(t))
+#else
+#include <pthread.h>
+#include <unistd.h>
+typedef pthread_mutex_t COINMUTEX;
+typedef pthread_cond_t COINCOND;
+typedef pthread_t COINTHREAD;
+#define coinInitMutex(m)      pthread_mutex_init(m, NULL)
+#define coinDestroyMutex(m)   pthread_mutex_destroy(m)
+#define coinLockMutex(m)      pthread_mutex_lock(m)
+#define coinUnlockMutex(m)    pthread_mutex_unlock(m)
+#define coinInitCond(c)       pthread_cond_init(c, NULL)
+#define coinDestroyCond(c)    pthread_cond_destroy(c)
+#define coinWaitCond(c, m)    pthread_cond_wait(c, m)
+#define coinWakeAllCond(c)    pthread_cond_broadcast(c)
+#define coinStartThread(t, f, a)  (pthread_create(t, NULL, f, a) == 0)
+#define coinJoinThread(t)     pthread_join(t, NULL)
+#endif
+
+
+/* Same codes as the solution status */
+#define BENDERS_OPTIMAL      0
+#define BENDERS_INFEASIBLE   1
+#define BENDERS_UNBOUNDED    2
+#define BENDERS_ITERLIMIT    3
+#define BENDERS_ERROR        4
+
+
+/************************************************************************/
+/*  Decomposition                                                       */
+/************************************************************************/
+
+/* The problem is split into a master problem over the first stage columns
+   and one subproblem per block over its second stage columns and rows.
+   The first stage part of the block rows is kept as T elements, so the
+   subproblem for a master solution x is solved with its row bounds moved
+   by -Tx.  Each block owns its ClpSimplex, which keeps its basis from one
+   iteration to the next.  Two elastic columns per row are kept closed at
+   zero and are only opened to measure the infeasibility of the block.
+
+   All objectives are taken in the minimize sense internally. */
+
+typedef struct {
+				int Block;
+				int RowCount;
+				int ColCount;
+				std::vector<int> Rows;          /* problem rows of the block */
+				std::vector<int> Cols;          /* problem columns of the block */
+				std::vector<int> LinkCols;      /* master columns used in the rows */
+
+				std::vector<int> TRow;
+				std::vector<int> TLink;
+				std::vector<double> TValue;
+
+				std::vector<double> RowLower;
+				std::vector<double> RowUpper;
+				std::vector<double> ObjCoeffs;
+				std::vector<double> Shift;      /* Tx of the last solve */
+				std::vector<double> WorkLower;
+				std::vector<double> WorkUpper;
+				std::vector<double> RowDual;
+
+				ClpSimplex* clp;
+				int HasCut;                     /* the estimate is in the master objective */
+
+				int Status;
+				double Value;
+				int IterCount;
+				std::vector<int> CutIndex;
+				std::vector<double> CutValues;
+				int CutNZCount;
+				double CutRhs;
+				} BENDERSBLOCK, *PBLOCK;
+
+
+typedef struct {
+				PPROBLEM pProblem;
+				int ObjectSense;
+				int BlockCount;
+				int FirstCount;
+				int MasterColCount;
+				int IsMip;
+				double CutTolerance;
+
+				std::vector<int> FirstCols;     /* problem column of each master column */
+				std::vector<int> MasterRows;
+				std::vector<int> MasterInts;
+
+				ClpSimplex* master;
+				std::vector<double> MasterSolution;
+				double MasterValue;
+				double MasterBound;
+				int MasterIterCount;
+				int MasterNodeCount;
+
+				std::vector<BENDERSBLOCK> Blocks;
+				} BENDERSINFO, *PBENDERS;
+
+
+static void BendersClear(PBENDERS pBenders)
+{
+	size_t k;
+
+	if (pBenders->master) {
+		delete pBenders->master;
+		pBenders->master = NULL;
+	}
+	for (k = 0; k < pBenders->Blocks.size(); k++) {
+		if (pBenders->Blocks[k].clp) {
+			delete pBenders->Blocks[k].clp;
+			pBenders->Blocks[k].clp = NULL;
+		}
+	}
+}
+
+
+/* Second stage columns may only appear in the rows of their own block,
+   which leaves master rows with first stage columns only */
+
+static int BendersCheckBlocks(PPROBLEM pProblem)
+{
+	int i, k, col;
+
+	if ((pProblem->QuadNZCount > 0) || (pProblem->SosCount > 0) || (pProblem->SemiCount > 0)) {
+		return 0;
+	}
+	for (col = 0; col < pProblem->ColCount; col++) {
+		if (pProblem->ColBlock[col] == 0) {
+			continue;
+		}
+		if (pProblem->SolveAsMIP && pProblem->IsInt && pProblem->IsInt[col]) {
+			return 0;
+		}
+		for (k = pProblem->MatrixBegin[col]; k < pProblem->MatrixBegin[col+1]; k++) {
+			i = pProblem->MatrixIndex[k];
+			if (pProblem->RowBlock[i] != pProblem->ColBlock[col]) {
+				return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+
+static int BendersCreateMaster(PBENDERS pBenders, const std::vector<int>& rowPos)
+{
+	PPROBLEM pProblem = pBenders->pProblem;
+	std::vector<int> start, index;
+	std::vector<double> value, lower, upper, objective, rowLower, rowUpper;
+	int m, i, k, col;
+
+	start.reserve(pBenders->MasterColCount + 1);
+	for (m = 0; m < pBenders->FirstCount; m++) {
+		col = pBenders->FirstCols[m];
+		start.push_back((int)index.size());
+		for (k = pProblem->MatrixBegin[col]; k < pProblem->MatrixBegin[col+1]; k++) {
+			i = pProblem->MatrixIndex[k];
+			if (pProblem->RowBlock[i] == 0) {
+				index.push_back(rowPos[i]);
+				value.push_back(pProblem->MatrixValues[k]);
+			}
+		}
+		lower.push_back(pProblem->LowerBounds[col]);
+		upper.push_back(pProblem->UpperBounds[col]);
+		objective.push_back(pBenders->ObjectSense * pProblem->ObjectCoeffs[col]);
+		if (pProblem->SolveAsMIP && pProblem->IsInt && pProblem->IsInt[col]) {
+			pBenders->MasterInts.push_back(m);
+		}
+	}
+	/* the block estimates stay out of the objective until their first cut */
+	for (k = 0; k < pBenders->BlockCount; k++) {
+		start.push_back((int)index.size());
+		lower.push_back(-COIN_DBL_MAX);
+		upper.push_back(COIN_DBL_MAX);
+		objective.push_back(0.0);
+	}
+	start.push_back((int)index.size());
+	for (m = 0; m < (int)pBenders->MasterRows.size(); m++) {
+		rowLower.push_back(pProblem->RowLower[pBenders->MasterRows[m]]);
+		rowUpper.push_back(pProblem->RowUpper[pBenders->MasterRows[m]]);
+	}
+	if (index.empty()) {
+		index.push_back(0);
+		value.push_back(0.0);
+	}
+	pBenders->master = new ClpSimplex();
+	pBenders->master->setLogLevel(0);
+	pBenders->master->loadProblem(pBenders->MasterColCount, (int)pBenders->MasterRows.size(),
+						&start[0], &index[0], &value[0], &lower[0], &upper[0], &objective[0],
+						rowLower.empty() ? NULL : &rowLower[0], rowUpper.empty() ? NULL : &rowUpper[0]);
+	pBenders->IsMip = pBenders->MasterInts.empty() ? 0 : 1;
+	return 1;
+}
+
+
+static int BendersCreateBlock(PBENDERS pBenders, PBLOCK pBlock, const std::vector<int>& colPos,
+				const std::vector<int>& rowPos)
+{
+	PPROBLEM pProblem = pBenders->pProblem;
+	std::vector<int> start, index;
+	std::vector<double> value, lower, upper;
+	int r, j, i, k, col;
+
+	pBlock->RowCount = (int)pBlock->Rows.size();
+	pBlock->ColCount = (int)pBlock->Cols.size();
+	for (j = 0; j < pBlock->ColCount; j++) {
+		col = pBlock->Cols[j];
+		start.push_back((int)index.size());
+		for (k = pProblem->MatrixBegin[col]; k < pProblem->MatrixBegin[col+1]; k++) {
+			index.push_back(rowPos[pProblem->MatrixIndex[k]]);
+			value.push_back(pProblem->MatrixValues[k]);
+		}
+		lower.push_back(pProblem->LowerBounds[col]);
+		upper.push_back(pProblem->UpperBounds[col]);
+		pBlock->ObjCoeffs.push_back(pBenders->ObjectSense * pProblem->ObjectCoeffs[col]);
+	}
+	/* elastic columns, one each way per row */
+	for (r = 0; r < pBlock->RowCount; r++) {
+		start.push_back((int)index.size());
+		index.push_back(r);
+		value.push_back(1.0);
+		start.push_back((int)index.size());
+		index.push_back(r);
+		value.push_back(-1.0);
+		lower.push_back(0.0);
+		lower.push_back(0.0);
+		upper.push_back(0.0);
+		upper.push_back(0.0);
+		pBlock->ObjCoeffs.push_back(0.0);
+		pBlock->ObjCoeffs.push_back(0.0);
+	}
+	start.push_back((int)index.size());
+	for (r = 0; r < pBlock->RowCount; r++) {
+		i = pBlock->Rows[r];
+		pBlock->RowLower.push_back(pProblem->RowLower[i]);
+		pBlock->RowUpper.push_back(pProblem->RowUpper[i]);
+	}
+	pBlock->Shift.assign(pBlock->RowCount, 0.0);
+	pBlock->RowDual.assign(pBlock->RowCount, 0.0);
+	pBlock->WorkLower = pBlock->RowLower;
+	pBlock->WorkUpper = pBlock->RowUpper;
+	if (index.empty()) {
+		index.push_back(0);
+		value.push_back(0.0);
+	}
+	pBlock->clp = new ClpSimplex();
+	pBlock->clp->setLogLevel(0);
+	pBlock->clp->loadProblem((int)start.size() - 1, pBlock->RowCount, &start[0], &index[0], &value[0],
+						lower.empty() ? NULL : &lower[0], upper.empty() ? NULL : &upper[0],
+						pBlock->ObjCoeffs.empty() ? NULL : &pBlock->ObjCoeffs[0],
+						pBlock->RowLower.empty() ? NULL : &pBlock->RowLower[0],
+						pBlock->RowUpper.empty() ? NULL : &pBlock->RowUpper[0]);
+	pBlock->CutIndex.resize(pBlock->LinkCols.size() + 1);
+	pBlock->CutValues.resize(pBlock->LinkCols.size() + 1);
+	return 1;
+}
+
+
+static int BendersCreateProblem(PBENDERS pBenders, PPROBLEM pProblem, POPTION pOption)
+{
+	std::vector<int> colPos(pProblem->ColCount);
+	std::vector<int> rowPos(pProblem->RowCount);
+	std::vector<int> lastLink;
+	std::vector<int> rowCount;
+	PBLOCK pBlock;
+	int i, k, m, b, col;
+
+	if (!BendersCheckBlocks(pProblem)) {
+		return 0;
+	}
+	pBenders->pProblem = pProblem;
+	pBenders->ObjectSense = pProblem->ObjectSense;
+	pBenders->BlockCount = pProblem->BlockCount;
+	pBenders->CutTolerance = coinGetRealOption(pOption, COIN_REAL_PRIMALOBJTOL);
+	pBenders->Blocks.resize(pBenders->BlockCount);
+	for (b = 0; b < pBenders->BlockCount; b++) {
+		pBenders->Blocks[b].Block = b + 1;
+		pBenders->Blocks[b].clp = NULL;
+		pBenders->Blocks[b].HasCut = 0;
+		pBenders->Blocks[b].IterCount = 0;
+		pBenders->Blocks[b].CutNZCount = 0;
+	}
+	for (col = 0; col < pProblem->ColCount; col++) {
+		b = pProblem->ColBlock[col];
+		if (b == 0) {
+			colPos[col] = (int)pBenders->FirstCols.size();
+			pBenders->FirstCols.push_back(col);
+		}
+		else {
+			colPos[col] = (int)pBenders->Blocks[b-1].Cols.size();
+			pBenders->Blocks[b-1].Cols.push_back(col);
+		}
+	}
+	for (i = 0; i < pProblem->RowCount; i++) {
+		b = pProblem->RowBlock[i];
+		if (b == 0) {
+			rowPos[i] = (int)pBenders->MasterRows.size();
+			pBenders->MasterRows.push_back(i);
+		}
+		else {
+			rowPos[i] = (int)pBenders->Blocks[b-1].Rows.size();
+			pBenders->Blocks[b-1].Rows.push_back(i);
+		}
+	}
+	pBenders->FirstCount = (int)pBenders->FirstCols.size();
+	pBenders->MasterColCount = pBenders->FirstCount + pBenders->BlockCount;
+
+	/* first stage elements of the block rows, each block lists the master
+	   columns it uses once */
+	lastLink.assign(pBenders->BlockCount, -1);
+	for (m = 0; m < pBenders->FirstCount; m++) {
+		col = pBenders->FirstCols[m];
+		for (k = pProblem->MatrixBegin[col]; k < pProblem->MatrixBegin[col+1]; k++) {
+			i = pProblem->MatrixIndex[k];
+			b = pProblem->RowBlock[i];
+			if (b == 0) {
+				continue;
+			}
+			pBlock = &pBenders->Blocks[b-1];
+			if (lastLink[b-1] != m) {
+				lastLink[b-1] = m;
+				pBlock->LinkCols.push_back(m);
+			}
+			pBlock->TRow.push_back(rowPos[i]);
+			pBlock->TLink.push_back((int)pBlock->LinkCols.size() - 1);
+			pBlock->TValue.push_back(pProblem->MatrixValues[k]);
+		}
+	}
+	BendersCreateMaster(pBenders, rowPos);
+	pBenders->MasterSolution.assign(pBenders->MasterColCount, 0.0);
+	for (b = 0; b < pBenders->BlockCount; b++) {
+		BendersCreateBlock(pBenders, &pBenders->Blocks[b], colPos, rowPos);
+	}
+	return 1;
+}
+
+
+/************************************************************************/
+/*  Subproblems                                                         */
+/************************************************************************/
+
+/* Measures how far the block is from feasible with the elastic columns
+   opened, the duals of this phase one problem give the feasibility cut */
+
+static int BendersSolvePhaseOne(PBLOCK pBlock)
+{
+	ClpSimplex* clp = pBlock->clp;
+	int j, art, artCount;
+	int result;
+
+	artCount = 2 * pBlock->RowCount;
+	for (j = 0; j < pBlock->ColCount; j++) {
+		clp->setObjectiveCoefficient(j, 0.0);
+	}
+	for (art = pBlock->ColCount; art < pBlock->ColCount + artCount; art++) {
+		clp->setObjectiveCoefficient(art, 1.0);
+		clp->setColumnUpper(art, COIN_DBL_MAX);
+	}
+	clp->primal();
+	pBlock->IterCount += clp->numberIterations();
+	result = clp->isProvenOptimal() ? 1 : 0;
+	if (result) {
+		pBlock->Value = clp->objectiveValue();
+		CoinCopyN(clp->dualRowSolution(), pBlock->RowCount, &pBlock->RowDual[0]);
+	}
+	for (j = 0; j < pBlock->ColCount; j++) {
+		clp->setObjectiveCoefficient(j, pBlock->ObjCoeffs[j]);
+	}
+	for (art = pBlock->ColCount; art < pBlock->ColCount + artCount; art++) {
+		clp->setObjectiveCoefficient(art, 0.0);
+		clp->setColumnUpper(art, 0.0);
+	}
+	return result;
+}
+
+
+/* Solves block for the master columns in MasterSolution and leaves its
+   optimality or feasibility cut in CutIndex and CutValues.  Called from
+   the worker threads, it only touches the block itself. */
+
+static void BendersSolveBlock(PBENDERS pBenders, PBLOCK pBlock)
+{
+	ClpSimplex* clp = pBlock->clp;
+	const double* xValue = &pBenders->MasterSolution[0];
+	int r, e, l, nz;
+	double coeff;
+
+	std::fill(pBlock->Shift.begin(), pBlock->Shift.end(), 0.0);
+	for (e = 0; e < (int)pBlock->TRow.size(); e++) {
+		pBlock->Shift[pBlock->TRow[e]] += pBlock->TValue[e] * xValue[pBlock->LinkCols[pBlock->TLink[e]]];
+	}
+	for (r = 0; r < pBlock->RowCount; r++) {
+		pBlock->WorkLower[r] = (pBlock->RowLower[r] > -COIN_DBL_MAX) ? pBlock->RowLower[r] - pBlock->Shift[r] : -COIN_DBL_MAX;
+		pBlock->WorkUpper[r] = (pBlock->RowUpper[r] < COIN_DBL_MAX) ? pBlock->RowUpper[r] - pBlock->Shift[r] : COIN_DBL_MAX;
+	}
+	if (pBlock->RowCount > 0) {
+		clp->chgRowLower(&pBlock->WorkLower[0]);
+		clp->chgRowUpper(&pBlock->WorkUpper[0]);
+	}
+	clp->dual();
+	pBlock->IterCount += clp->numberIterations();
+
+	if (clp->isProvenOptimal()) {
+		pBlock->Status = BENDERS_OPTIMAL;
+		pBlock->Value = clp->objectiveValue();
+		if (pBlock->RowCount > 0) {
+			CoinCopyN(clp->dualRowSolution(), pBlock->RowCount, &pBlock->RowDual[0]);
+		}
+	}
+	else if (clp->isProvenDualInfeasible()) {
+		pBlock->Status = BENDERS_UNBOUNDED;
+		return;
+	}
+	else if (clp->isProvenPrimalInfeasible()) {
+		if (!BendersSolvePhaseOne(pBlock) || (pBlock->Value <= pBenders->CutTolerance)) {
+			pBlock->Status = BENDERS_ERROR;
+			return;
+		}
+		pBlock->Status = BENDERS_INFEASIBLE;
+	}
+	else {
+		pBlock->Status = BENDERS_ERROR;
+		return;
+	}
+
+	/* Q(x) >= Q(xk) - g(x - xk) with g = u'T for the row duals u */
+	std::fill(pBlock->CutValues.begin(), pBlock->CutValues.end(), 0.0);
+	for (e = 0; e < (int)pBlock->TRow.size(); e++) {
+		pBlock->CutValues[pBlock->TLink[e]] += pBlock->RowDual[pBlock->TRow[e]] * pBlock->TValue[e];
+	}
+	pBlock->CutRhs = pBlock->Value;
+	nz = 0;
+	for (l = 0; l < (int)pBlock->LinkCols.size(); l++) {
+		coeff = pBlock->CutValues[l];
+		if (fabs(coeff) < 1e-12) {
+			continue;
+		}
+		pBlock->CutRhs += coeff * xValue[pBlock->LinkCols[l]];
+		pBlock->CutIndex[nz] = pBlock->LinkCols[l];
+		pBlock->CutValues[nz] = coeff;
+		nz++;
+	}
+	pBlock->CutNZCount = nz;
+}
+
+
+/************************************************************************/
+/*  Thread Pool                                                         */
+/************************************************************************/
+
+/* The workers live for one Benders solve.  Each iteration bumps the
+   generation, the workers and the calling thread then take blocks off a
+   shared counter until all blocks are solved. */
+
+typedef struct {
+				int ThreadCount;
+				std::vector<COINTHREAD> Threads;
+
+				COINMUTEX Mutex;
+				COINCOND WorkReady;
+				COINCOND WorkDone;
+				int Generation;
+				int NextBlock;
+				int BlocksDone;
+				int Shutdown;
+
+				PBENDERS pBenders;
+				} BENDERSPOOL, *PPOOL;
+
+
+/* Called with the mutex held */
+
+static void BendersRunBlocks(PPOOL pPool)
+{
+	PBENDERS pBenders = pPool->pBenders;
+	int block;
+
+	while (pPool->NextBlock < pBenders->BlockCount) {
+		block = pPool->NextBlock++;
+		coinUnlockMutex(&pPool->Mutex);
+		BendersSolveBlock(pBenders, &pBenders->Blocks[block]);
+		coinLockMutex(&pPool->Mutex);
+		pPool->BlocksDone++;
+	}
+	if (pPool->BlocksDone == pBenders->BlockCount) {
+		coinWakeAllCond(&pPool->WorkDone);
+	}
+}
+
+
+static void BendersWorkerLoop(PPOOL pPool)
+{
+	int generation = 0;
+
+	coinLockMutex(&pPool->Mutex);
+	for (;;) {
+		while (!pPool->Shutdown && (pPool->Generation == generation)) {
+			coinWaitCond(&pPool->WorkReady, &pPool->Mutex);
+		}
+		if (pPool->Shutdown) {
+			break;
+		}
+		generation = pPool->Generation;
+		BendersRunBlocks(pPool);
+	}
+	coinUnlockMutex(&pPool->Mutex);
+}
+
+
+#if defined(_WIN32)
+static DWORD WINAPI BendersWorkerThread(LPVOID pArg)
+{
+	BendersWorkerLoop((PPOOL)pArg);
+	return 0;
+}
+#else
+static void* BendersWorkerThread(void* pArg)
+{
+	BendersWorkerLoop((PPOOL)pArg);
+	return NULL;
+}
+#endif
+
+
+static int BendersProcessorCount(void)
+{
+#if defined(_WIN32)
+	SYSTEM_INFO info;
+
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (count > 0) ? (int)count : 1;
+#endif
+}
+
+
+/* Threads that cannot be started only leave more blocks to the others */
+
+static void BendersStartPool(PPOOL pPool, PBENDERS pBenders, int ThreadCount)
+{
+	int i;
+
+	pPool->pBenders = pBenders;
+	pPool->Generation = 0;
+	pPool->NextBlock = 0;
+	pPool->BlocksDone = 0;
+	pPool->Shutdown = 0;
+	coinInitMutex(&pPool->Mutex);
+	coinInitCond(&pPool->WorkReady);
+	coinInitCond(&pPool->WorkDone);
+
+	if (ThreadCount <= 0) {
+		ThreadCount = BendersProcessorCount();
+	}
+	if (ThreadCount > pBenders->BlockCount) {
+		ThreadCount = pBenders->BlockCount;
+	}
+	/* the calling thread is one of them */
+	pPool->Threads.resize(ThreadCount > 1 ? ThreadCount - 1 : 0);
+	pPool->ThreadCount = 0;
+	for (i = 0; i < (int)pPool->Threads.size(); i++) {
+		if (!coinStartThread(&pPool->Threads[pPool->ThreadCount], BendersWorkerThread, pPool)) {
+			break;
+		}
+		pPool->ThreadCount++;
+	}
+}
+
+
+static void BendersStopPool(PPOOL pPool)
+{
+	int i;
+
+	coinLockMutex(&pPool->Mutex);
+	pPool->Shutdown = 1;
+	coinWakeAllCond(&pPool->WorkReady);
+	coinUnlockMutex(&pPool->Mutex);
+	for (i = 0; i < pPool->ThreadCount; i++) {
+		coinJoinThread(pPool->Threads[i]);
+	}
+	coinDestroyCond(&pPool->WorkDone);
+	coinDestroyCond(&pPool->WorkReady);
+	coinDestroyMutex(&pPool->Mutex);
+}
+
+
+static void BendersSolveAllBlocks(PPOOL pPool)
+{
+	coinLockMutex(&pPool->Mutex);
+	pPool->NextBlock = 0;
+	pPool->BlocksDone = 0;
+	pPool->Generation++;
+	coinWakeAllCond(&pPool->WorkReady);
+	BendersRunBlocks(pPool);
+	while (pPool->BlocksDone < pPool->pBenders->BlockCount) {
+		coinWaitCond(&pPool->WorkDone, &pPool->Mutex);
+	}
+	coinUnlockMutex(&pPool->Mutex);
+}
+
+
+/************************************************************************/
+/*  Master Problem                                                      */
+/************************************************************************/
+
+static int BendersSolveMaster(PBENDERS pBenders)
+{
+	ClpSimplex* master = pBenders->master;
+
+	if (!pBenders->IsMip) {
+		master->dual();
+		pBenders->MasterIterCount += master->numberIterations();
+		if (master->isProvenPrimalInfeasible()) {
+			return BENDERS_INFEASIBLE;
+		}
+		if (master->isProvenDualInfeasible()) {
+			return BENDERS_UNBOUNDED;
+		}
+		if (!master->isProvenOptimal()) {
+			return BENDERS_ERROR;
+		}
+		memcpy(&pBenders->MasterSolution[0], master->primalColumnSolution(),
+					pBenders->MasterColCount * sizeof(double));
+		pBenders->MasterValue = master->objectiveValue();
+		pBenders->MasterBound = pBenders->MasterValue;
+		return BENDERS_OPTIMAL;
+	}
+	/* the model works on its own copy, the master keeps only the cuts */
+	OsiClpSolverInterface osi(master, false);
+	osi.setInteger(&pBenders->MasterInts[0], (int)pBenders->MasterInts.size());
+	CbcModel model(osi);
+	model.setLogLevel(0);
+	model.branchAndBound();
+	pBenders->MasterIterCount += model.getIterationCount();
+	pBenders->MasterNodeCount += model.getNodeCount();
+	if (!model.bestSolution()) {
+		return model.isProvenInfeasible() ? BENDERS_INFEASIBLE : BENDERS_ERROR;
+	}
+	memcpy(&pBenders->MasterSolution[0], model.bestSolution(),
+				pBenders->MasterColCount * sizeof(double));
+	pBenders->MasterValue = model.getObjValue();
+	pBenders->MasterBound = model.getBestPossibleObjValue();
+	return BENDERS_OPTIMAL;
+}
+
+
+/* Collects the cuts of all blocks and adds them to the master in one go.
+   Returns the number of cuts, or -1 when a cut cannot be stored. */
+
+static int BendersAddCuts(PBENDERS pBenders, PCUTBUF pCutBuf)
+{
+	PBLOCK pBlock;
+	int b, theta;
+	double estimate, tolerance;
+
+	coinResetCutBuffer(pCutBuf);
+	for (b = 0; b < pBenders->BlockCount; b++) {
+		pBlock = &pBenders->Blocks[b];
+		if (pBlock->Status == BENDERS_INFEASIBLE) {
+			if (!coinAddCutRow(pCutBuf, pBlock->CutNZCount, &pBlock->CutIndex[0], &pBlock->CutValues[0],
+						pBlock->CutRhs, COIN_DBL_MAX)) {
+				return -1;
+			}
+			continue;
+		}
+		theta = pBenders->FirstCount + b;
+		estimate = pBenders->MasterSolution[theta];
+		tolerance = pBenders->CutTolerance * CoinMax(1.0, fabs(pBlock->Value));
+		if (pBlock->HasCut && (pBlock->Value <= estimate + tolerance)) {
+			continue;
+		}
+		if (!pBlock->HasCut) {
+			pBenders->master->setObjectiveCoefficient(theta, 1.0);
+			pBlock->HasCut = 1;
+		}
+		pBlock->CutIndex[pBlock->CutNZCount] = theta;
+		pBlock->CutValues[pBlock->CutNZCount] = 1.0;
+		if (!coinAddCutRow(pCutBuf, pBlock->CutNZCount + 1, &pBlock->CutIndex[0], &pBlock->CutValues[0],
+					pBlock->CutRhs, COIN_DBL_MAX)) {
+			return -1;
+		}
+	}
+	if (pCutBuf->CutCount > 0) {
+		pBenders->master->addRows(pCutBuf->CutCount, pCutBuf->CutLower, pCutBuf->CutUpper,
+					pCutBuf->CutBegin, pCutBuf->CutIndex, pCutBuf->CutValues);
+	}
+	return pCutBuf->CutCount;
+}
+
+
+static int BendersAllEstimated(PBENDERS pBenders)
+{
+	int b;
+
+	for (b = 0; b < pBenders->BlockCount; b++) {
+		if (!pBenders->Blocks[b].HasCut) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+
+/* Keeps the best solution found so far in the result, the master duals
+   stand in for the duals of the first stage rows */
+
+static void BendersStoreSolution(PBENDERS pBenders, PRESULT pResult)
+{
+	PPROBLEM pProblem = pBenders->pProblem;
+	PBLOCK pBlock;
+	const double* colPrimal;
+	const double* colDual;
+	const double* rowPrimal;
+	const double* rowDual;
+	double sense = pBenders->ObjectSense;
+	int m, j, r, b;
+
+	for (m = 0; m < pBenders->FirstCount; m++) {
+		pResult->ColActivity[pBenders->FirstCols[m]] = pBenders->MasterSolution[m];
+	}
+	if (!pBenders->IsMip) {
+		colDual = pBenders->master->dualColumnSolution();
+		rowPrimal = pBenders->master->primalRowSolution();
+		rowDual = pBenders->master->dualRowSolution();
+		for (m = 0; m < pBenders->FirstCount; m++) {
+			pResult->ReducedCost[pBenders->FirstCols[m]] = sense * colDual[m];
+		}
+		for (r = 0; r < (int)pBenders->MasterRows.size(); r++) {
+			pResult->RowActivity[pBenders->MasterRows[r]] = rowPrimal[r];
+			pResult->ShadowPrice[pBenders->MasterRows[r]] = sense * rowDual[r];
+		}
+	}
+	for (b = 0; b < pBenders->BlockCount; b++) {
+		pBlock = &pBenders->Blocks[b];
+		colPrimal = pBlock->clp->primalColumnSolution();
+		for (j = 0; j < pBlock->ColCount; j++) {
+			pResult->ColActivity[pBlock->Cols[j]] = colPrimal[j];
+		}
+		if (pBenders->IsMip) {
+			continue;
+		}
+		colDual = pBlock->clp->dualColumnSolution();
+		rowPrimal = pBlock->clp->primalRowSolution();
+		rowDual = pBlock->clp->dualRowSolution();
+		for (j = 0; j < pBlock->ColCount; j++) {
+			pResult->ReducedCost[pBlock->Cols[j]] = sense * colDual[j];
+		}
+		for (r = 0; r < pBlock->RowCount; r++) {
+			pResult->RowActivity[pBlock->Rows[r]] = rowPrimal[r] + pBlock->Shift[r];
+			pResult->ShadowPrice[pBlock->Rows[r]] = sense * rowDual[r];
+		}
+	}
+	if (!pBenders->IsMip) {
+		coinComputeRowSlack(pProblem, pResult->RowActivity, pResult->SlackValues);
+	}
+}
+
+
+/************************************************************************/
+/*  Benders Loop                                                        */
+/************************************************************************/
+
+static int BendersSolve(PBENDERS pBenders, PRESULT pResult, PSOLVER pSolver, POPTION pOption,
+				int* IterCount)
+{
+	BENDERSPOOL pool;
+	CUTBUFINFO cutBuf;
+	PBLOCK pBlock;
+	int maxIter, iter, b;
+	int status, allFeasible, cutCount;
+	double gap, upperBound, lowerBound, value;
+
+	maxIter = coinGetIntOption(pOption, COIN_INT_BENDERSMAXITER);
+	gap = coinGetRealOption(pOption, COIN_REAL_BENDERSGAP);
+	upperBound = COIN_DBL_MAX;
+	lowerBound = -COIN_DBL_MAX;
+	pResult->ObjectValue = 0.0;
+	status = BENDERS_ITERLIMIT;
+
+	coinInitCutBuffer(&cutBuf, pBenders->MasterColCount);
+	BendersStartPool(&pool, pBenders, coinGetIntOption(pOption, COIN_INT_BENDERSTHREADS));
+	for (iter = 0; iter < maxIter; iter++) {
+		status = BendersSolveMaster(pBenders);
+		if (status != BENDERS_OPTIMAL) {
+			break;
+		}
+		if (BendersAllEstimated(pBenders)) {
+			lowerBound = pBenders->MasterBound;
+		}
+
+		BendersSolveAllBlocks(&pool);
+
+		allFeasible = 1;
+		value = 0.0;
+		for (b = 0; b < pBenders->BlockCount; b++) {
+			pBlock = &pBenders->Blocks[b];
+			if ((pBlock->Status == BENDERS_UNBOUNDED) || (pBlock->Status == BENDERS_ERROR)) {
+				status = pBlock->Status;
+				break;
+			}
+			if (pBlock->Status == BENDERS_INFEASIBLE) {
+				allFeasible = 0;
+			}
+			else {
+				value += pBlock->Value;
+			}
+		}
+		if (b < pBenders->BlockCount) {
+			break;
+		}
+		if (allFeasible) {
+			for (b = 0; b < pBenders->FirstCount; b++) {
+				value += pBenders->ObjectSense * pBenders->pProblem->ObjectCoeffs[pBenders->FirstCols[b]] *
+							pBenders->MasterSolution[b];
+			}
+			if (value < upperBound) {
+				upperBound = value;
+				pResult->ObjectValue = pBenders->ObjectSense * upperBound;
+				BendersStoreSolution(pBenders, pResult);
+			}
+		}
+		coinPublishMipProgress(pSolver, iter + 1, pBenders->MasterNodeCount,
+					pBenders->ObjectSense * lowerBound, pBenders->ObjectSense * upperBound);
+		if ((upperBound < COIN_DBL_MAX) && (lowerBound > -COIN_DBL_MAX) &&
+				(upperBound - lowerBound <= gap * CoinMax(1.0, fabs(upperBound)))) {
+			status = BENDERS_OPTIMAL;
+			iter++;
+			break;
+		}
+		cutCount = BendersAddCuts(pBenders, &cutBuf);
+		if (cutCount < 0) {
+			status = BENDERS_ERROR;
+			break;
+		}
+		if ((cutCount == 0) && allFeasible) {
+			/* no block is above its estimate, so the master is exact */
+			lowerBound = upperBound;
+			status = BENDERS_OPTIMAL;
+			iter++;
+			break;
+		}
+		status = BENDERS_ITERLIMIT;
+	}
+	BendersStopPool(&pool);
+	coinClearCutBuffer(&cutBuf);
+
+	pResult->MipBestBound = pBenders->ObjectSense * lowerBound;
+	*IterCount = iter;
+	return status;
+}
+
+
+int BendersOptimizeProblem(PPROBLEM pProblem, PRESULT pResult, PSOLVER pSolver, POPTION pOption)
+{
+	BENDERSINFO benders;
+	int status, iterCount, b;
+	int phase;
+
+	coinResetSolveStats(pResult);
+	coinReleaseSolutionView(pResult);
+	if ((pProblem->BlockCount <= 0) || !pProblem->ColBlock || !pProblem->RowBlock) {
+		return CBC_CALL_FAILED;
+	}
+	/* the master and the subproblems are solved without the MIP callbacks,
+	   a lazy constraint the callback would add could be violated */
+	if (pSolver->MipSolutionCB || pSolver->LazyConCB || pSolver->UserCutCB || pSolver->HeuristicCB) {
+		return CBC_CALL_FAILED;
+	}
+	benders.master = NULL;
+	benders.MasterValue = 0.0;
+	benders.MasterBound = 0.0;
+	benders.MasterIterCount = 0;
+	benders.MasterNodeCount = 0;
+	CbcStartPhase(pResult, COIN_PHASE_LOAD);
+	if (!BendersCreateProblem(&benders, pProblem, pOption)) {
+		CbcStopPhase(pResult, COIN_PHASE_LOAD);
+		BendersClear(&benders);
+		return CBC_CALL_FAILED;
+	}
+	if (!coinAllocSolutionArrays(pResult, pProblem->ColCount, pProblem->RowCount, benders.IsMip)) {
+		CbcStopPhase(pResult, COIN_PHASE_LOAD);
+		BendersClear(&benders);
+		return CBC_CALL_FAILED;
+	}
+	memset(pResult->ColActivity, 0, pProblem->ColCount * sizeof(double));
+	if (!benders.IsMip) {
+		memset(pResult->ReducedCost, 0, pProblem->ColCount * sizeof(double));
+		memset(pResult->RowActivity, 0, pProblem->RowCount * sizeof(double));
+		memset(pResult->SlackValues, 0, pProblem->RowCount * sizeof(double));
+		memset(pResult->ShadowPrice, 0, pProblem->RowCount * sizeof(double));
+	}
+	CbcStopPhase(pResult, COIN_PHASE_LOAD);
+
+	coinBeginProgress(pSolver, CoinGetTimeOfDay());
+	CbcStartPhase(pResult, COIN_PHASE_LPSOLVE);
+	status = BendersSolve(&benders, pResult, pSolver, pOption, &iterCount);
+	CbcStopPhase(pResult, COIN_PHASE_LPSOLVE);
+	coinEndProgress(pSolver, CoinGetTimeOfDay());
+
+	CbcStartPhase(pResult, COIN_PHASE_RESULTS);
+	pResult->SolutionStatus = status;
+	pResult->IterCount = benders.MasterIterCount;
+	for (b = 0; b < benders.BlockCount; b++) {
+		pResult->IterCount += benders.Blocks[b].IterCount;
+	}
+	pResult->MipNodeCount = benders.MasterNodeCount;
+	pResult->Stats.BendersIterCount = iterCount;
+	switch (status) {
+		case BENDERS_OPTIMAL:    strcpy(pResult->SolutionText, "Optimal solution found");		break;
+		case BENDERS_INFEASIBLE: strcpy(pResult->SolutionText, "Problem primal infeasible");	break;
+		case BENDERS_UNBOUNDED:  strcpy(pResult->SolutionText, "Problem dual infeasible");		break;
+		case BENDERS_ITERLIMIT:  strcpy(pResult->SolutionText, "Stopped on Benders iterations");	break;
+		default:                 strcpy(pResult->SolutionText, "Stopped due to errors");		break;
+	}
+	CbcStopPhase(pResult, COIN_PHASE_RESULTS);
+	BendersClear(&benders);
+
+	for (phase = COIN_PHASE_LOAD; phase < COIN_PHASE_COUNT; phase++) {
+		pResult->Stats.TotalWallTime += pResult->Stats.WallTime[phase];
+		pResult->Stats.TotalCpuTime += pResult->Stats.CpuTime[phase];
+	}
+	pResult->Stats.ProblemBytes = coinGetProblemBytes(pProblem);
+	pResult->Stats.ResultBytes = coinGetResultBytes(pResult, pProblem->ColCount, pProblem->RowCount);
+	return CBC_CALL_SUCCESS;
+}
@@ -0,0 +1,25 @@
+
+/*  CoinBenders.h  */
+
+
+#ifndef _COINBENDERS_H_
+#define _COINBENDERS_H_
+
+
+/* Same value as SOLV_METHOD_BENDERS in CoinMP.h */
+#define SOLV_METHOD_BENDERS       0x00000100L
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+int BendersOptimizeProblem(PPROBLEM pProblem, PRESULT pResult, PSOLVER pSolver, POPTION pOption);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* _COINBENDERS_H_ */
@@ -0,0 +1,486 @@
+
+/*  CoinCache.c  */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "CoinCache.h"
+
+
+#if defined(_WIN32)
+#include <windows.h>
+typedef CRITICAL_SECTION COINMUTEX;
+#define coinInitMutex(m)      InitializeCriticalSection(m)
+#define coinDestroyMutex(m)   DeleteCriticalSection(m)
+#define coinLockMutex(m)      EnterCriticalSection(m)
+#define coinUnlockMutex(m)    LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t COINMUTEX;
+#define coinInitMutex(m)      pthread_mutex_init(m, NULL)
+#define coinDestroyMutex(m)   pthread_mutex_destroy(m)
+#define coinLockMutex(m)      pthread_mutex_lock(m)
+#define coinUnlockMutex(m)    pthread_mutex_unlock(m)
+#endif
+
+
+PCACHE coinCreateCache(int MaxEntries)
+{
+	PCACHE pCache;
+
+	pCache = (PCACHE)malloc(sizeof(CACHEINFO));
+	if (!pCache) {
+		return NULL;
+	}
+	memset(pCache, 0, sizeof(CACHEINFO));
+	pCache->Mutex = malloc(sizeof(COINMUTEX));
+	if (!pCache->Mutex) {
+		free(pCache);
+		return NULL;
+	}
+	coinInitMutex((COINMUTEX*)pCache->Mutex);
+
+	pCache->MaxEntries = MaxEntries;
+	pCache->EntryCount = 0;
+	pCache->HitCount = 0;
+	pCache->MissCount = 0;
+	pCache->Head = NULL;
+	pCache->Tail = NULL;
+	pCache->SpillDir = NULL;
+	return pCache;
+}
+
+
+static int coinGetBucket(PCACHEKEY pKey)
+{
+	return (int)(pKey->Key[0] % COIN_CACHE_BUCKETS);
+}
+
+
+static int coinSameKey(PCACHEKEY pKey1, PCACHEKEY pKey2)
+{
+	return (pKey1->Key[0] == pKey2->Key[0]) && (pKey1->Key[1] == pKey2->Key[1]) &&
+		   (pKey1->Key[2] == pKey2->Key[2]) && (pKey1->Key[3] == pKey2->Key[3]);
+}
+
+
+/* Entries found by Key[] are only used when the rest of the key matches,
+   otherwise the lookup counts as a miss */
+
+static int coinSameCheck(PCACHEKEY pKey1, PCACHEKEY pKey2)
+{
+	return (pKey1->Check[0] == pKey2->Check[0]) && (pKey1->Check[1] == pKey2->Check[1]) &&
+		   (pKey1->ColCount == pKey2->ColCount) && (pKey1->RowCount == pKey2->RowCount) &&
+		   (pKey1->NZCount == pKey2->NZCount) && (pKey1->Method == pKey2->Method);
+}
+
+
+static void coinUnlinkEntry(PCACHE pCache, PCACHEENTRY pEntry)
+{
+	if (pEntry->Prev) pEntry->Prev->Next = pEntry->Next;
+	else pCache->Head = pEntry->Next;
+	if (pEntry->Next) pEntry->Next->Prev = pEntry->Prev;
+	else pCache->Tail = pEntry->Prev;
+	pEntry->Prev = NULL;
+	pEntry->Next = NULL;
+}
+
+
+static void coinLinkEntryFirst(PCACHE pCache, PCACHEENTRY pEntry)
+{
+	pEntry->Prev = NULL;
+	pEntry->Next = pCache->Head;
+	if (pCache->Head) pCache->Head->Prev = pEntry;
+	pCache->Head = pEntry;
+	if (!pCache->Tail) pCache->Tail = pEntry;
+}
+
+
+static PCACHEENTRY coinFindEntry(PCACHE pCache, PCACHEKEY pKey)
+{
+	PCACHEENTRY pEntry;
+
+	for (pEntry = pCache->Buckets[coinGetBucket(pKey)]; pEntry; pEntry = pEntry->BucketNext) {
+		if (coinSameKey(&pEntry->Key, pKey)) {
+			return pEntry;
+		}
+	}
+	return NULL;
+}
+
+
+static void coinDeleteEntry(PCACHE pCache, PCACHEENTRY pEntry)
+{
+	PCACHEENTRY* ppEntry;
+
+	for (ppEntry = &pCache->Buckets[coinGetBucket(&pEntry->Key)]; *ppEntry; ppEntry = &(*ppEntry)->BucketNext) {
+		if (*ppEntry == pEntry) {
+			*ppEntry = pEntry->BucketNext;
+			break;
+		}
+	}
+	coinUnlinkEntry(pCache, pEntry);
+	free(pEntry->Data);
+	free(pEntry);
+	pCache->EntryCount--;
+}
+
+
+static void coinTrimCache(PCACHE pCache)
+{
+	while ((pCache->EntryCount > pCache->MaxEntries) && pCache->Tail) {
+		coinDeleteEntry(pCache, pCache->Tail);
+	}
+}
+
+
+void coinClearCache(PCACHE pCache)
+{
+	if (!pCache) {
+		return;
+	}
+	while (pCache->Head) {
+		coinDeleteEntry(pCache, pCache->Head);
+	}
+	coinDestroyMutex((COINMUTEX*)pCache->Mutex);
+	free(pCache->Mutex);
+	if (pCache->SpillDir) free(pCache->SpillDir);
+	free(pCache);
+}
+
+
+void coinSetCacheSize(PCACHE pCache, int MaxEntries)
+{
+	if (!pCache) {
+		return;
+	}
+	coinLockMutex((COINMUTEX*)pCache->Mutex);
+	pCache->MaxEntries = MaxEntries;
+	coinTrimCache(pCache);
+	coinUnlockMutex((COINMUTEX*)pCache->Mutex);
+}
+
+
+int coinSetCacheSpillDir(PCACHE pCache, const char* SpillDir)
+{
+	char* copy = NULL;
+
+	if (!pCache) {
+		return 0;
+	}
+	if (SpillDir && SpillDir[0]) {
+		copy = (char*)malloc(strlen(SpillDir) + 1);
+		if (!copy) {
+			return 0;
+		}
+		strcpy(copy, SpillDir);
+	}
+	coinLockMutex((COINMUTEX*)pCache->Mutex);
+	if (pCache->SpillDir) free(pCache->SpillDir);
+	pCache->SpillDir = copy;
+	coinUnlockMutex((COINMUTEX*)pCache->Mutex);
+	return 1;
+}
+
+
+#define SPILL_MAGIC  0x43434d32   /* "CCM2" */
+
+
+static void coinGetSpillName(PCACHE pCache, PCACHEKEY pKey, char* Filename, int buflen)
+{
+	char name[40];
+
+	sprintf(name, "%08x%08x%08x%08x.ccm", pKey->Key[0], pKey->Key[1], pKey->Key[2], pKey->Key[3]);
+	if (strlen(pCache->SpillDir) + strlen(name) + 2 > (size_t)buflen) {
+		Filename[0] = '\0';
+		return;
+	}
+	sprintf(Filename, "%s/%s", pCache->SpillDir, name);
+}
+
+
+/* Spill files hold a magic number, the data size, the full key and the
+   data.  A file is only read back when its whole key matches. */
+
+static void coinWriteSpillFile(PCACHE pCache, PCACHEKEY pKey, const void* Data, int DataSize)
+{
+	char filename[1024];
+	FILE* fp;
+	int header[2];
+
+	/* the size is stored as an int, an overflowed size is never written */
+	if (DataSize < 0) {
+		return;
+	}
+	coinGetSpillName(pCache, pKey, filename, sizeof(filename));
+	if (!filename[0]) {
+		return;
+	}
+	fp = fopen(filename, "wb");
+	if (!fp) {
+		return;
+	}
+	header[0] = SPILL_MAGIC;
+	header[1] = DataSize;
+	if ((fwrite(header, sizeof(header), 1, fp) != 1) ||
+		(fwrite(pKey, sizeof(CACHEKEY), 1, fp) != 1) ||
+		((DataSize > 0) && (fwrite(Data, DataSize, 1, fp) != 1))) {
+		fclose(fp);
+		remove(filename);
+		return;
+	}
+	fclose(fp);
+}
+
+
+static char* coinReadSpillFile(PCACHE pCache, PCACHEKEY pKey, int* DataSize)
+{
+	char filename[1024];
+	FILE* fp;
+	int header[2];
+	CACHEKEY fileKey;
+	char* data = NULL;
+
+	coinGetSpillName(pCache, pKey, filename, sizeof(filename));
+	if (!filename[0]) {
+		return NULL;
+	}
+	fp = fopen(filename, "rb");
+	if (!fp) {
+		return NULL;
+	}
+	if ((fread(header, sizeof(header), 1, fp) == 1) && (header[0] == SPILL_MAGIC) && (header[1] >= 0) &&
+		(fread(&fileKey, sizeof(CACHEKEY), 1, fp) == 1) &&
+		coinSameKey(&fileKey, pKey) && coinSameCheck(&fileKey, pKey)) {
+		data = (char*)malloc(header[1] > 0 ? header[1] : 1);
+		if (data && (header[1] > 0) && (fread(data, header[1], 1, fp) != 1)) {
+			free(data);
+			data = NULL;
+		}
+		*DataSize = header[1];
+	}
+	fclose(fp);
+	return data;
+}
+
+
+/* Links a new entry that takes over the Data block, the cache is locked */
+
+static int coinInsertEntry(PCACHE pCache, PCACHEKEY pKey, char* Data, int DataSize)
+{
+	PCACHEENTRY pEntry;
+	int bucket;
+
+	pEntry = coinFindEntry(pCache, pKey);
+	if (pEntry) {
+		free(pEntry->Data);
+		coinUnlinkEntry(pCache, pEntry);
+	}
+	else {
+		pEntry = (PCACHEENTRY)malloc(sizeof(CACHEENTRY));
+		if (!pEntry) {
+			free(Data);
+			return 0;
+		}
+		bucket = coinGetBucket(pKey);
+		pEntry->BucketNext = pCache->Buckets[bucket];
+		pCache->Buckets[bucket] = pEntry;
+		pCache->EntryCount++;
+	}
+	pEntry->Key = *pKey;
+	pEntry->Data = Data;
+	pEntry->DataSize = DataSize;
+	coinLinkEntryFirst(pCache, pEntry);
+	coinTrimCache(pCache);
+	return 1;
+}
+
+
+/* Returns a malloced copy of the cached data, the caller frees it */
+
+int coinCacheFetch(PCACHE pCache, PCACHEKEY pKey, void** Data, int* DataSize)
+{
+	PCACHEENTRY pEntry;
+	char* spillData;
+	int spillSize;
+	int found = 0;
+
+	if (!pCache) {
+		return 0;
+	}
+	coinLockMutex((COINMUTEX*)pCache->Mutex);
+	pEntry = coinFindEntry(pCache, pKey);
+	if (pEntry && !coinSameCheck(&pEntry->Key, pKey)) {
+		pEntry = NULL;
+	}
+	else if (pEntry) {
+		*Data = malloc(pEntry->DataSize > 0 ? pEntry->DataSize : 1);
+		if (*Data) {
+			memcpy(*Data, pEntry->Data, pEntry->DataSize);
+			*DataSize = pEntry->DataSize;
+			coinUnlinkEntry(pCache, pEntry);
+			coinLinkEntryFirst(pCache, pEntry);
+			found = 1;
+		}
+	}
+	else if (pCache->SpillDir) {
+		spillData = coinReadSpillFile(pCache, pKey, &spillSize);
+		if (spillData) {
+			*Data = malloc(spillSize > 0 ? spillSize : 1);
+			if (*Data) {
+				memcpy(*Data, spillData, spillSize);
+				*DataSize = spillSize;
+				found = 1;
+			}
+			if (pCache->MaxEntries > 0)
+				coinInsertEntry(pCache, pKey, spillData, spillSize);
+			else {
+				free(spillData);
+			}
+		}
+	}
+	if (found) pCache->HitCount++;
+	else pCache->MissCount++;
+	coinUnlockMutex((COINMUTEX*)pCache->Mutex);
+	return found;
+}
+
+
+int coinCacheStore(PCACHE pCache, PCACHEKEY pKey, const void* Data, int DataSize)
+{
+	char* copy;
+	int result;
+
+	if (!pCache || (pCache->MaxEntries <= 0)) {
+		return 0;
+	}
+	copy = (char*)malloc(DataSize > 0 ? DataSize : 1);
+	if (!copy) {
+		return 0;
+	}
+	memcpy(copy, Data, DataSize);
+	coinLockMutex((COINMUTEX*)pCache->Mutex);
+	if (pCache->SpillDir) {
+		coinWriteSpillFile(pCache, pKey, Data, DataSize);
+	}
+	result = coinInsertEntry(pCache, pKey, copy, DataSize);
+	coinUnlockMutex((COINMUTEX*)pCache->Mutex);
+	return result;
+}
+
+
+void coinGetCacheCounts(PCACHE pCache, int* EntryCount, int* HitCount, int* MissCount)
+{
+	if (!pCache) {
+		*EntryCount = *HitCount = *MissCount = 0;
+		return;
+	}
+	coinLockMutex((COINMUTEX*)pCache->Mutex);
+	*EntryCount = pCache->EntryCount;
+	*HitCount = pCache->HitCount;
+	*MissCount = pCache->MissCount;
+	coinUnlockMutex((COINMUTEX*)pCache->Mutex);
+}
+
+
+/* Streaming 128 bit hash for cache keys.  Each of the four lanes mixes
+   every 32 bit word with its own multiplier, so data can be hashed in
+   pieces as it is stored. */
+
+static const unsigned int HashMultiplier[4] = {0xcc9e2d51U, 0x1b873593U, 0x85ebca6bU, 0xc2b2ae35U};
+
+
+void coinInitCacheKey(PCACHEKEY pKey)
+{
+	pKey->Key[0] = 0x243f6a88U;
+	pKey->Key[1] = 0x85a308d3U;
+	pKey->Key[2] = 0x13198a2eU;
+	pKey->Key[3] = 0x03707344U;
+	pKey->Check[0] = 0x811c9dc5U;
+	pKey->Check[1] = 0x5bd1e995U;
+	pKey->ColCount = 0;
+	pKey->RowCount = 0;
+	pKey->NZCount = 0;
+	pKey->Method = 0;
+}
+
+
+static void coinHashWord(PCACHEKEY pKey, unsigned int word)
+{
+	unsigned int h;
+	int lane;
+
+	for (lane = 0; lane < 4; lane++) {
+		h = pKey->Key[lane] ^ (word * HashMultiplier[lane]);
+		h = (h << 13) | (h >> 19);
+		pKey->Key[lane] = h * 5 + 0xe6546b64U;
+	}
+	/* the check digest uses other operations, a collision in Key[] does
+	   not carry over to it */
+	h = (pKey->Check[0] ^ word) * 0x01000193U;
+	pKey->Check[0] = h ^ (h >> 15);
+	h = pKey->Check[1] + word;
+	pKey->Check[1] = (h ^ (h >> 13)) * 0x2c1b3c6dU;
+}
+
+
+static unsigned int coinMixFinal(unsigned int h)
+{
+	h ^= h >> 16;
+	h *= 0x85ebca6bU;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35U;
+	h ^= h >> 16;
+	return h;
+}
+
+
+/* Records the problem size and method in the key and mixes every lane
+   once more, so that all input bits reach all bits of the key */
+
+void coinFinishCacheKey(PCACHEKEY pKey, int ColCount, int RowCount, int NZCount, int Method)
+{
+	int lane;
+
+	pKey->ColCount = ColCount;
+	pKey->RowCount = RowCount;
+	pKey->NZCount = NZCount;
+	pKey->Method = Method;
+	coinHashWord(pKey, (unsigned int)ColCount);
+	coinHashWord(pKey, (unsigned int)RowCount);
+	coinHashWord(pKey, (unsigned int)NZCount);
+	coinHashWord(pKey, (unsigned int)Method);
+	for (lane = 0; lane < 4; lane++) {
+		pKey->Key[lane] = coinMixFinal(pKey->Key[lane] ^ pKey->Key[(lane + 1) % 4]);
+	}
+	pKey->Check[0] = coinMixFinal(pKey->Check[0]);
+	pKey->Check[1] = coinMixFinal(pKey->Check[1] ^ pKey->Check[0]);
+}
+
+
+void coinHashCacheKey(PCACHEKEY pKey, const void* Data, size_t DataSize)
+{
+	const unsigned char* bytes = (const unsigned char*)Data;
+	unsigned int word;
+	size_t i;
+
+	if (!Data) {
+		DataSize = 0;
+	}
+	for (i = 0; i + 4 <= DataSize; i += 4) {
+		memcpy(&word, bytes + i, 4);
+		coinHashWord(pKey, word);
+	}
+	if (i < DataSize) {
+		word = 0;
+		memcpy(&word, bytes + i, DataSize - i);
+		coinHashWord(pKey, word);
+	}
+	/* the length keeps a missing array apart from an empty one, arrays
+	   of 4GB and more also hash the upper half of the length */
+	coinHashWord(pKey, (unsigned int)DataSize ^ 0x9e3779b9U);
+	if (DataSize > 0xffffffffUL) {
+		coinHashWord(pKey, (unsigned int)(DataSize >> 16 >> 16));
+	}
+}
@@ -0,0 +1,86 @@
+
+/*  CoinCache.h  */
+
+
+#ifndef _COINCACHE_H_
+#define _COINCACHE_H_
+
+#include <stddef.h>   /* size_t */
+
+
+#define COIN_CACHE_BUCKETS   256
+
+
+/* Key[] finds the entry and names its spill file.  A hit is only taken
+   when the independent Check[] digest, the problem size and the method
+   stored with the entry match as well. */
+
+typedef struct {
+				unsigned int Key[4];
+				unsigned int Check[2];
+				int ColCount;
+				int RowCount;
+				int NZCount;
+				int Method;
+				} CACHEKEY, *PCACHEKEY;
+
+
+typedef struct tagCACHEENTRY {
+				CACHEKEY Key;
+				int DataSize;
+				char* Data;
+
+				struct tagCACHEENTRY* Prev;       /* recency list, head is newest */
+				struct tagCACHEENTRY* Next;
+				struct tagCACHEENTRY* BucketNext;
+				} CACHEENTRY, *PCACHEENTRY;
+
+
+/* Bounded cache of data blocks keyed by a 128 bit key, the least recently
+   used entry is dropped when it is full.  All calls lock the cache so it
+   can be shared between problems solved on different threads.  With a
+   spill directory every entry is also written to a file, entries dropped
+   from memory are then read back from disk. */
+
+typedef struct {
+				int MaxEntries;
+				int EntryCount;
+				int HitCount;
+				int MissCount;
+
+				PCACHEENTRY Head;
+				PCACHEENTRY Tail;
+				PCACHEENTRY Buckets[COIN_CACHE_BUCKETS];
+
+				char* SpillDir;     /* entries are also kept here as files */
+
+				void* Mutex;        /* platform lock, see CoinCache.c */
+				} CACHEINFO, *PCACHE;
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+PCACHE coinCreateCache(int MaxEntries);
+void   coinClearCache(PCACHE pCache);
+
+void   coinSetCacheSize(PCACHE pCache, int MaxEntries);
+int    coinSetCacheSpillDir(PCACHE pCache, const char* SpillDir);
+
+int    coinCacheFetch(PCACHE pCache, PCACHEKEY pKey, void** Data, int* DataSize);
+int    coinCacheStore(PCACHE pCache, PCACHEKEY pKey, const void* Data, int DataSize);
+
+void   coinGetCacheCounts(PCACHE pCache, int* EntryCount, int* HitCount, int* MissCount);
+
+void   coinInitCacheKey(PCACHEKEY pKey);
+void   coinHashCacheKey(PCACHEKEY pKey, const void* Data, size_t DataSize);
+void   coinFinishCacheKey(PCACHEKEY pKey, int ColCount, int RowCount, int NZCount, int Method);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* _COINCACHE_H_ */
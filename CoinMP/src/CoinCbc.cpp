@@ -7,11 +7,15 @@
 #include "CoinResult.h"
 #include "CoinSolver.h"
 #include "CoinOption.h"
+#include "CoinCache.h"
 
 #include <cfloat>
+#include <cmath>
 
 #include "CoinHelperFunctions.hpp"
 #include "CoinMessageHandler.hpp"
+#include "CoinTime.hpp"
+#include "CoinPackedMatrix.hpp"
 
 #include "ClpSimplex.hpp"
 #include "ClpPrimalColumnSteepest.hpp"
@@ -24,6 +28,8 @@
 #include "CbcModel.hpp"
 #include "CbcSolver.hpp"
 #include "CbcEventHandler.hpp"
+#include "CbcCutGenerator.hpp"
+#include "CbcHeuristic.hpp"
 #include "CbcBranchActual.hpp"   // CbcSOS
 #include "CbcBranchLotsize.hpp"  // CbcLotsize
 
@@ -34,15 +40,49 @@
 #include "CglClique.hpp"
 #include "CglLiftAndProject.hpp"
 #include "CglSimpleRounding.hpp"
+#include "OsiCuts.hpp"
+#include "OsiRowCut.hpp"
 
 
 #include "CoinCbc.h"
+#include "CoinBenders.h"
+#include "CoinScenario.h"
 
 #define NEW_STYLE_CBCMAIN
 
 
 typedef void *HCBC;
 
+
+/************************************************************************/
+/*  Solve Statistics                                                    */
+/************************************************************************/
+
+
+void CbcStartPhase(PRESULT pResult, int Phase)
+{
+	pResult->Stats.WallStart[Phase] = CoinGetTimeOfDay();
+	pResult->Stats.CpuStart[Phase] = CoinCpuTime();
+}
+
+
+void CbcStopPhase(PRESULT pResult, int Phase)
+{
+	if (pResult->Stats.WallStart[Phase] == 0.0) {
+		return;
+	}
+	pResult->Stats.WallTime[Phase] += CoinGetTimeOfDay() - pResult->Stats.WallStart[Phase];
+	pResult->Stats.CpuTime[Phase] += CoinCpuTime() - pResult->Stats.CpuStart[Phase];
+	pResult->Stats.WallStart[Phase] = 0.0;
+	pResult->Stats.CpuStart[Phase] = 0.0;
+}
+
+
+int CbcPhaseRunning(PRESULT pResult, int Phase)
+{
+	return pResult->Stats.WallStart[Phase] != 0.0;
+}
+
 /************************************************************************/
 /*  Message Callback Handler                                            */
 /************************************************************************/
@@ -148,6 +188,9 @@ class CBIterHandler : public ClpEventHandler {
 public:
    void registerLPIterCallback(COIN_LPITER_CB LPIterCB, void* LPIterParam);
    void setIterCallback(ITERCALLBACK iterCallback);
+   void setSolveStats(PRESULT pResult);
+   void setProgress(PSOLVER pSolver);
+   void setCallbackFrequency(int iterFreq, int msecFreq);
 
    virtual int event(Event whichEvent);
 
@@ -169,6 +212,12 @@ private:
 	COIN_LPITER_CB LPIterCB_;
 	void* LPIterParam_;
 	ITERCALLBACK iterCallback_;
+	PRESULT pResult_;
+	PSOLVER pSolver_;
+	int iterFreq_;
+	int msecFreq_;
+	int iterSinceCall_;
+	double lastCallTime_;
 };
 
 
@@ -188,6 +237,27 @@ void CBIterHandler::setIterCallback(ITERCALLBACK iterCallback)
 }
 
 
+void CBIterHandler::setSolveStats(PRESULT pResult)
+{
+  pResult_ = pResult;
+}
+
+
+void CBIterHandler::setProgress(PSOLVER pSolver)
+{
+  pSolver_ = pSolver;
+}
+
+
+void CBIterHandler::setCallbackFrequency(int iterFreq, int msecFreq)
+{
+  iterFreq_ = iterFreq;
+  msecFreq_ = msecFreq;
+  iterSinceCall_ = 0;
+  lastCallTime_ = 0.0;
+}
+
+
 
 int CBIterHandler::event(Event whichEvent)
 {
@@ -196,13 +266,38 @@ int CBIterHandler::event(Event whichEvent)
 	int isPrimalFeasible;
 	int isDualFeasible;
 	double sumPrimalInfeas;
-	double sumDualInfeas;
+	double now;
 	int cancelAsap;
 
 	if ((whichEvent==endOfIteration)) {
+		/* first simplex iteration marks the end of presolve and crash */
+		if (pResult_ && CbcPhaseRunning(pResult_, COIN_PHASE_PRESOLVE)) {
+			CbcStopPhase(pResult_, COIN_PHASE_PRESOLVE);
+			CbcStartPhase(pResult_, COIN_PHASE_LPSOLVE);
+		}
+		if (pSolver_) {
+			coinPublishLPProgress(pSolver_, model_->getIterationCount(), model_->getObjValue());
+		}
+		if (!LPIterCB_ && !iterCallback_) {
+			return -1;
+		}
+		/* only query the model when the callback is due */
+		if (++iterSinceCall_ < iterFreq_) {
+			return -1;
+		}
+		if (msecFreq_ > 0) {
+			now = CoinGetTimeOfDay();
+			if (lastCallTime_ == 0.0) {
+				lastCallTime_ = now;
+			}
+			else if ((now - lastCallTime_) * 1000.0 < msecFreq_) {
+				return -1;
+			}
+			lastCallTime_ = now;
+		}
+		iterSinceCall_ = 0;
 		numIter = model_->getIterationCount();
 		objValue = model_->getObjValue();
-		sumDualInfeas = model_->sumDualInfeasibilities();
 		sumPrimalInfeas = model_->sumPrimalInfeasibilities();
 		isPrimalFeasible = model_->primalFeasible();
 		isDualFeasible = model_->dualFeasible();
@@ -225,13 +320,41 @@ CBIterHandler::CBIterHandler () : ClpEventHandler()
 	LPIterCB_ = NULL;
 	LPIterParam_ = NULL;
 	iterCallback_ = NULL;
+	pResult_ = NULL;
+	pSolver_ = NULL;
+	iterFreq_ = 1;
+	msecFreq_ = 0;
+	iterSinceCall_ = 0;
+	lastCallTime_ = 0.0;
 }
 
 // Copy constructor
-CBIterHandler::CBIterHandler (const CBIterHandler & rhs) : ClpEventHandler(rhs) {}
+CBIterHandler::CBIterHandler (const CBIterHandler & rhs) : ClpEventHandler(rhs)
+{
+	LPIterCB_ = rhs.LPIterCB_;
+	LPIterParam_ = rhs.LPIterParam_;
+	iterCallback_ = rhs.iterCallback_;
+	pResult_ = rhs.pResult_;
+	pSolver_ = rhs.pSolver_;
+	iterFreq_ = rhs.iterFreq_;
+	msecFreq_ = rhs.msecFreq_;
+	iterSinceCall_ = rhs.iterSinceCall_;
+	lastCallTime_ = rhs.lastCallTime_;
+}
 
 // Constructor with pointer to model
-CBIterHandler::CBIterHandler(ClpSimplex * model) : ClpEventHandler(model) {}
+CBIterHandler::CBIterHandler(ClpSimplex * model) : ClpEventHandler(model)
+{
+	LPIterCB_ = NULL;
+	LPIterParam_ = NULL;
+	iterCallback_ = NULL;
+	pResult_ = NULL;
+	pSolver_ = NULL;
+	iterFreq_ = 1;
+	msecFreq_ = 0;
+	iterSinceCall_ = 0;
+	lastCallTime_ = 0.0;
+}
 
 // Destructor
 CBIterHandler::~CBIterHandler () {}
@@ -254,6 +377,12 @@ ClpEventHandler * CBIterHandler::clone() const
 	iterhandler->LPIterCB_ = this->LPIterCB_;
 	iterhandler->LPIterParam_ = this->LPIterParam_;
 	iterhandler->iterCallback_ = this->iterCallback_;
+	iterhandler->pResult_ = this->pResult_;
+	iterhandler->pSolver_ = this->pSolver_;
+	iterhandler->iterFreq_ = this->iterFreq_;
+	iterhandler->msecFreq_ = this->msecFreq_;
+	iterhandler->iterSinceCall_ = this->iterSinceCall_;
+	iterhandler->lastCallTime_ = this->lastCallTime_;
 	return iterhandler;
 }
 
@@ -269,6 +398,10 @@ class CBNodeHandler : public CbcEventHandler {
 public:
 	void registerCallback(COIN_MIPNODE_CB MipNodeCB, void* MipNodeParam);
 	void setCallback(MIPNODECALLBACK mipNodeCallback);
+	void setProgress(PSOLVER pSolver);
+	void setSolutionPool(PRESULT pResult, int ColCount, int ObjectSense, double StartTime);
+	void registerSolutionCallback(COIN_MIPSOL_CB MipSolutionCB, void* MipSolutionParam,
+								  int ColCount, int* SolutionsSent);
 
 	virtual CbcAction event(CbcEvent whichEvent);
 
@@ -294,6 +427,15 @@ private:
 	void* MipNodeParam_;
 	MIPNODECALLBACK mipNodeCallback_;
 	int lastSolCount_;
+	PSOLVER pSolver_;
+	PRESULT poolResult_;
+	int poolColCount_;
+	int poolObjSense_;
+	double poolStartTime_;
+	COIN_MIPSOL_CB MipSolutionCB_;
+	void* MipSolutionParam_;
+	int solutionColCount_;
+	int* solutionsSent_;
 };
 
 
@@ -315,6 +457,34 @@ void CBNodeHandler::setCallback(MIPNODECALLBACK mipNodeCallback)
 }
 
 
+void CBNodeHandler::setProgress(PSOLVER pSolver)
+{
+	pSolver_ = pSolver;
+}
+
+
+void CBNodeHandler::setSolutionPool(PRESULT pResult, int ColCount, int ObjectSense, double StartTime)
+{
+	poolResult_ = pResult;
+	poolColCount_ = ColCount;
+	poolObjSense_ = ObjectSense;
+	poolStartTime_ = StartTime;
+}
+
+
+/* SolutionsSent is shared by all clones of the handler, so the caller can
+   tell afterwards whether any solution was delivered during the search */
+
+void CBNodeHandler::registerSolutionCallback(COIN_MIPSOL_CB MipSolutionCB, void* MipSolutionParam,
+											 int ColCount, int* SolutionsSent)
+{
+	MipSolutionCB_ = MipSolutionCB;
+	MipSolutionParam_ = MipSolutionParam;
+	solutionColCount_ = ColCount;
+	solutionsSent_ = SolutionsSent;
+}
+
+
 CBNodeHandler::CbcAction CBNodeHandler::event(CbcEvent whichEvent)
 {
 	int numIter;
@@ -329,6 +499,12 @@ CBNodeHandler::CbcAction CBNodeHandler::event(CbcEvent whichEvent)
 		numNodes = model_->getNodeCount();
 		objValue = model_->getObjValue();
 		bestBound = model_->getBestPossibleObjValue();
+		if (pSolver_) {
+			coinPublishMipProgress(pSolver_, numIter, numNodes, bestBound, objValue);
+		}
+		if (!MipNodeCB_ && !mipNodeCallback_) {
+			return noAction;
+		}
 		solCount = model_->getSolutionCount();
 		if (MipNodeCB_)
 			cancelAsap = MipNodeCB_(numIter, numNodes, bestBound, objValue, solCount != lastSolCount_, MipNodeParam_);
@@ -340,6 +516,24 @@ CBNodeHandler::CbcAction CBNodeHandler::event(CbcEvent whichEvent)
 			return stop;
 		}
 	}
+	else if ((whichEvent == solution) || (whichEvent == heuristicSolution)) {
+		/* solutions of a preprocessed model have other columns, those are
+		   left out and only the final solution is added after the solve */
+		if (poolResult_ && (model_->getNumCols() == poolColCount_) && model_->bestSolution()) {
+			coinAddPoolSolution(poolResult_, poolObjSense_, model_->bestSolution(),
+								model_->getObjValue(), CoinGetTimeOfDay() - poolStartTime_);
+		}
+		if (MipSolutionCB_ && (model_->getNumCols() == solutionColCount_) && model_->bestSolution()) {
+			if (solutionsSent_) {
+				(*solutionsSent_)++;
+			}
+			cancelAsap = MipSolutionCB_(model_->getNodeCount(), model_->getObjValue(),
+										solutionColCount_, model_->bestSolution(), MipSolutionParam_);
+			if (cancelAsap) {
+				return stop;
+			}
+		}
+	}
 	return noAction;
 }
 
@@ -351,14 +545,53 @@ CBNodeHandler::CBNodeHandler () : CbcEventHandler()
 	MipNodeParam_ = NULL;
 	mipNodeCallback_ = NULL;
 	lastSolCount_ = 0;
+	pSolver_ = NULL;
+	poolResult_ = NULL;
+	poolColCount_ = 0;
+	poolObjSense_ = 1;
+	poolStartTime_ = 0.0;
+	MipSolutionCB_ = NULL;
+	MipSolutionParam_ = NULL;
+	solutionColCount_ = 0;
+	solutionsSent_ = NULL;
 }
 
 // Copy constructor
-CBNodeHandler::CBNodeHandler (const CBNodeHandler & rhs) : CbcEventHandler(rhs) {}
+CBNodeHandler::CBNodeHandler (const CBNodeHandler & rhs) : CbcEventHandler(rhs)
+{
+	MipNodeCB_ = rhs.MipNodeCB_;
+	MipNodeParam_ = rhs.MipNodeParam_;
+	mipNodeCallback_ = rhs.mipNodeCallback_;
+	lastSolCount_ = rhs.lastSolCount_;
+	pSolver_ = rhs.pSolver_;
+	poolResult_ = rhs.poolResult_;
+	poolColCount_ = rhs.poolColCount_;
+	poolObjSense_ = rhs.poolObjSense_;
+	poolStartTime_ = rhs.poolStartTime_;
+	MipSolutionCB_ = rhs.MipSolutionCB_;
+	MipSolutionParam_ = rhs.MipSolutionParam_;
+	solutionColCount_ = rhs.solutionColCount_;
+	solutionsSent_ = rhs.solutionsSent_;
+}
 
 // Constructor with pointer to model
 //JPF: CBNodeHandler::CBNodeHandler(ClpSimplex * model) : CbcEventHandler(model) {}
-CBNodeHandler::CBNodeHandler(CbcModel * model) : CbcEventHandler(model) {}
+CBNodeHandler::CBNodeHandler(CbcModel * model) : CbcEventHandler(model)
+{
+	MipNodeCB_ = NULL;
+	MipNodeParam_ = NULL;
+	mipNodeCallback_ = NULL;
+	lastSolCount_ = 0;
+	pSolver_ = NULL;
+	poolResult_ = NULL;
+	poolColCount_ = 0;
+	poolObjSense_ = 1;
+	poolStartTime_ = 0.0;
+	MipSolutionCB_ = NULL;
+	MipSolutionParam_ = NULL;
+	solutionColCount_ = 0;
+	solutionsSent_ = NULL;
+}
 
 // Destructor
 CBNodeHandler::~CBNodeHandler () {}
@@ -382,10 +615,272 @@ CbcEventHandler * CBNodeHandler::clone() const
 	nodehandler->MipNodeParam_ = this->MipNodeParam_;
 	nodehandler->lastSolCount_ = this->lastSolCount_;
 	nodehandler->mipNodeCallback_ = this->mipNodeCallback_;
+	nodehandler->pSolver_ = this->pSolver_;
+	nodehandler->poolResult_ = this->poolResult_;
+	nodehandler->poolColCount_ = this->poolColCount_;
+	nodehandler->poolObjSense_ = this->poolObjSense_;
+	nodehandler->poolStartTime_ = this->poolStartTime_;
+	nodehandler->MipSolutionCB_ = this->MipSolutionCB_;
+	nodehandler->MipSolutionParam_ = this->MipSolutionParam_;
+	nodehandler->solutionColCount_ = this->solutionColCount_;
+	nodehandler->solutionsSent_ = this->solutionsSent_;
 	return nodehandler;
 }
 
 
+
+/************************************************************************/
+/*  User Cut Generators                                                 */
+/************************************************************************/
+
+
+/* Wraps the lazy constraint and the user cut callbacks as Cgl generators.
+   The lazy callback only sees LP solutions that are integer on all integer
+   columns, Cbc also calls it with every new solution.  The separator is
+   called with fractional LP solutions in the cut rounds like the Cgl
+   generators.  Rows from both must be valid for the whole tree and are
+   added as global cuts, so a solution that violates a lazy row is never
+   accepted. */
+
+class CBUserCuts : public CglCutGenerator {
+
+public:
+	CBUserCuts(PPROBLEM pProblem, double IntTolerance);
+	CBUserCuts(const CBUserCuts& rhs);
+	virtual ~CBUserCuts();
+
+	void registerLazyCallback(COIN_LAZYCON_CB LazyConCB, void* LazyConParam);
+	void registerCutCallback(COIN_USERCUT_CB UserCutCB, void* UserCutParam);
+
+	virtual void generateCuts(const OsiSolverInterface& si, OsiCuts& cs,
+							  const CglTreeInfo info = CglTreeInfo());
+	virtual CglCutGenerator* clone() const;
+
+private:
+	CBUserCuts& operator=(const CBUserCuts& rhs);
+
+	bool isIntegerSolution(const double* colValues) const;
+
+	COIN_LAZYCON_CB LazyConCB_;
+	void* LazyConParam_;
+	COIN_USERCUT_CB UserCutCB_;
+	void* UserCutParam_;
+	double intTolerance_;
+	std::vector<int> intColumns_;
+	CUTBUFINFO cutBuf_;
+};
+
+
+CBUserCuts::CBUserCuts(PPROBLEM pProblem, double IntTolerance) : CglCutGenerator()
+{
+	int i;
+
+	LazyConCB_ = NULL;
+	LazyConParam_ = NULL;
+	UserCutCB_ = NULL;
+	UserCutParam_ = NULL;
+	intTolerance_ = IntTolerance;
+	intColumns_.reserve(pProblem->numInts);
+	for (i = 0; i < pProblem->ColCount; i++) {
+		if (pProblem->IsInt && pProblem->IsInt[i]) {
+			intColumns_.push_back(i);
+		}
+	}
+	coinInitCutBuffer(&cutBuf_, pProblem->ColCount);
+}
+
+// Copy constructor, every copy gets its own cut buffer
+CBUserCuts::CBUserCuts(const CBUserCuts& rhs) : CglCutGenerator(rhs)
+{
+	LazyConCB_ = rhs.LazyConCB_;
+	LazyConParam_ = rhs.LazyConParam_;
+	UserCutCB_ = rhs.UserCutCB_;
+	UserCutParam_ = rhs.UserCutParam_;
+	intTolerance_ = rhs.intTolerance_;
+	intColumns_ = rhs.intColumns_;
+	coinInitCutBuffer(&cutBuf_, rhs.cutBuf_.ColCount);
+}
+
+// Destructor
+CBUserCuts::~CBUserCuts()
+{
+	coinClearCutBuffer(&cutBuf_);
+}
+
+// Clone
+CglCutGenerator* CBUserCuts::clone() const
+{
+	return new CBUserCuts(*this);
+}
+
+
+void CBUserCuts::registerLazyCallback(COIN_LAZYCON_CB LazyConCB, void* LazyConParam)
+{
+	LazyConCB_ = LazyConCB;
+	LazyConParam_ = LazyConParam;
+}
+
+
+void CBUserCuts::registerCutCallback(COIN_USERCUT_CB UserCutCB, void* UserCutParam)
+{
+	UserCutCB_ = UserCutCB;
+	UserCutParam_ = UserCutParam;
+}
+
+
+bool CBUserCuts::isIntegerSolution(const double* colValues) const
+{
+	double value;
+	size_t i;
+
+	for (i = 0; i < intColumns_.size(); i++) {
+		value = colValues[intColumns_[i]];
+		if (fabs(value - floor(value + 0.5)) > intTolerance_) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+void CBUserCuts::generateCuts(const OsiSolverInterface& si, OsiCuts& cs, const CglTreeInfo info)
+{
+	const double* colValues;
+	int k, begin;
+
+	if (si.getNumCols() != cutBuf_.ColCount) {
+		return;
+	}
+	colValues = si.getColSolution();
+	coinResetCutBuffer(&cutBuf_);
+	if (LazyConCB_) {
+		if (!isIntegerSolution(colValues)) {
+			return;
+		}
+		LazyConCB_(cutBuf_.ColCount, colValues, si.getObjValue(), (HCUTS)&cutBuf_, LazyConParam_);
+	}
+	else if (UserCutCB_) {
+		UserCutCB_(cutBuf_.ColCount, colValues, si.getObjValue(), info.level, (HCUTS)&cutBuf_, UserCutParam_);
+	}
+	for (k = 0; k < cutBuf_.CutCount; k++) {
+		OsiRowCut rowCut;
+
+		begin = cutBuf_.CutBegin[k];
+		rowCut.setRow(cutBuf_.CutBegin[k+1] - begin, &cutBuf_.CutIndex[begin], &cutBuf_.CutValues[begin], false);
+		rowCut.setLb(cutBuf_.CutLower[k]);
+		rowCut.setUb(cutBuf_.CutUpper[k]);
+		rowCut.setGloballyValid(true);
+		cs.insert(rowCut);
+	}
+}
+
+
+/************************************************************************/
+/*  User Heuristic                                                      */
+/************************************************************************/
+
+
+/* Passes the LP solution of the current node to the user heuristic at most
+   once every NodeFreq nodes.  A returned solution is only offered to Cbc if
+   it improves the incumbent, Cbc then checks its feasibility before it is
+   accepted. */
+
+class CBUserHeuristic : public CbcHeuristic {
+
+public:
+	CBUserHeuristic(CbcModel& model, COIN_HEURISTIC_CB HeuristicCB, void* HeuristicParam, int NodeFreq);
+	CBUserHeuristic(const CBUserHeuristic& rhs);
+	virtual ~CBUserHeuristic();
+
+	virtual CbcHeuristic* clone() const;
+	virtual void resetModel(CbcModel* model);
+	virtual int solution(double& objectiveValue, double* newSolution);
+
+private:
+	CBUserHeuristic& operator=(const CBUserHeuristic& rhs);
+
+	COIN_HEURISTIC_CB HeuristicCB_;
+	void* HeuristicParam_;
+	int nodeFreq_;
+	int lastNode_;
+	std::vector<double> candidate_;
+};
+
+
+CBUserHeuristic::CBUserHeuristic(CbcModel& model, COIN_HEURISTIC_CB HeuristicCB, void* HeuristicParam, int NodeFreq)
+	: CbcHeuristic(model)
+{
+	HeuristicCB_ = HeuristicCB;
+	HeuristicParam_ = HeuristicParam;
+	nodeFreq_ = NodeFreq;
+	lastNode_ = -1;
+}
+
+// Copy constructor
+CBUserHeuristic::CBUserHeuristic(const CBUserHeuristic& rhs) : CbcHeuristic(rhs)
+{
+	HeuristicCB_ = rhs.HeuristicCB_;
+	HeuristicParam_ = rhs.HeuristicParam_;
+	nodeFreq_ = rhs.nodeFreq_;
+	lastNode_ = rhs.lastNode_;
+}
+
+// Destructor
+CBUserHeuristic::~CBUserHeuristic()
+{
+}
+
+// Clone
+CbcHeuristic* CBUserHeuristic::clone() const
+{
+	return new CBUserHeuristic(*this);
+}
+
+
+void CBUserHeuristic::resetModel(CbcModel* model)
+{
+	model_ = model;
+	lastNode_ = -1;
+}
+
+
+int CBUserHeuristic::solution(double& objectiveValue, double* newSolution)
+{
+	OsiSolverInterface* solver;
+	const double* objCoeffs;
+	double value;
+	int nodeCount, colCount, i;
+
+	nodeCount = model_->getNodeCount();
+	if (lastNode_ >= 0) {
+		if ((nodeFreq_ <= 0) || (nodeCount - lastNode_ < nodeFreq_)) {
+			return 0;
+		}
+	}
+	lastNode_ = nodeCount;
+	solver = model_->solver();
+	colCount = solver->getNumCols();
+	candidate_.resize(colCount);
+	if (!HeuristicCB_(nodeCount, colCount, solver->getColSolution(), &candidate_[0], HeuristicParam_)) {
+		return 0;
+	}
+	/* Cbc compares in the minimization sense, without the constant */
+	objCoeffs = solver->getObjCoefficients();
+	value = 0.0;
+	for (i = 0; i < colCount; i++) {
+		value += objCoeffs[i] * candidate_[i];
+	}
+	value *= solver->getObjSense();
+	if (value >= objectiveValue) {
+		return 0;
+	}
+	memcpy(newSolution, &candidate_[0], colCount * sizeof(double));
+	objectiveValue = value;
+	return 1;
+}
+
+
+
 /************************************************************************/
 /*  Coin Problem Info Structure                                         */
 /************************************************************************/
@@ -396,6 +891,17 @@ typedef struct {
 				OsiClpSolverInterface *osi;
 				CbcModel *cbc;
 
+				// callback handlers
+				CBMessageHandler *msghandler;
+				CBIterHandler *iterhandler;
+				CBNodeHandler *nodehandler;
+
+				int mipSolutionsSent;
+
+				} CBCINFO, *PCBC;
+
+
+typedef struct {
 				CglProbing *probing;
 				CglGomory *gomory;
 				CglKnapsackCover *knapsack;
@@ -404,12 +910,8 @@ typedef struct {
 				CglLiftAndProject *liftpro;
 				CglSimpleRounding *rounding;
 
-				// callback handlers
-				CBMessageHandler *msghandler;
-				CBIterHandler *iterhandler;
-				CBNodeHandler *nodehandler;
-
-				} CBCINFO, *PCBC;
+				int OptionChangeCount;
+				} CUTGENINFO, *PCUTGEN;
 
 
 HCBC CbcCreateSolverObject(void)
@@ -422,14 +924,17 @@ HCBC CbcCreateSolverObject(void)
 	}
 	memset(pCbc, 0, sizeof(CBCINFO));
 
+	/* ClpSolve and the Osi interface are only created when a solve needs
+	   them, a plain LP solve only pays for the ClpSimplex */
 	pCbc->clp = new ClpSimplex();
-	pCbc->clp_presolve = new ClpSolve();
-	pCbc->osi = new OsiClpSolverInterface(pCbc->clp);
+	pCbc->clp_presolve = NULL;
+	pCbc->osi = NULL;
 	pCbc->cbc = NULL;  /* ERRORFIX 2005/2/22: Crashes if not NULL when trying to set message handler */
 
 	pCbc->msghandler = NULL;
 	pCbc->iterhandler = NULL;
 	pCbc->nodehandler = NULL;
+	pCbc->mipSolutionsSent = 0;
 	return (HCBC)pCbc;
 }
 
@@ -440,10 +945,12 @@ void CbcClearSolverObject(HCBC hCbc)
 	if (!pCbc) {
 		return;
 	}
+	/* CbcModel works on its own clone of the Osi interface, and the Osi
+	   interface does not own the ClpSimplex, so it has to go first */
+	if (pCbc->cbc) delete pCbc->cbc;
+	if (pCbc->osi) delete pCbc->osi;
 	if (pCbc->clp) delete pCbc->clp;
 	if (pCbc->clp_presolve) delete pCbc->clp_presolve;
-	//if (pCbc->osi) delete pCbc->osi;
-	if (pCbc->cbc) delete pCbc->cbc;
 
 	if (pCbc->msghandler)	delete pCbc->msghandler;
 	if (pCbc->iterhandler)	delete pCbc->iterhandler;
@@ -452,6 +959,17 @@ void CbcClearSolverObject(HCBC hCbc)
 	free(pCbc);
 }
 
+OsiClpSolverInterface* CbcGetOsiSolver(HCBC hCbc)
+{
+	PCBC pCbc = (PCBC)hCbc;
+
+	if (!pCbc->osi) {
+		pCbc->osi = new OsiClpSolverInterface(pCbc->clp);
+		if (pCbc->msghandler) pCbc->osi->passInMessageHandler(pCbc->msghandler);
+	}
+	return pCbc->osi;
+}
+
 /************************************************************************/
 /*  Callback Handling                                                   */
 /************************************************************************/
@@ -559,18 +1077,200 @@ int CbcSetMipNodeCallback(HCBC hCbc, MIPNODECALLBACK MipNodeCallback)
 }
 
 
+/* The solution callback shares the node handler, it is added to the handler
+   set up for the node callback or a new one */
+
+int CbcRegisterMipSolutionCallback(HCBC hCbc, COIN_MIPSOL_CB MipSolutionCB, void* MipSolutionParam)
+{
+	PCBC pCbc = (PCBC)hCbc;
+
+	if (!MipSolutionCB || !pCbc->cbc) {
+		return CBC_CALL_FAILED;
+	}
+	if (!pCbc->nodehandler) {
+		pCbc->nodehandler = new CBNodeHandler(pCbc->cbc);
+	}
+	pCbc->nodehandler->registerSolutionCallback(MipSolutionCB, MipSolutionParam,
+							pCbc->cbc->getNumCols(), &pCbc->mipSolutionsSent);
+	pCbc->cbc->passInEventHandler(pCbc->nodehandler);
+	return CBC_CALL_SUCCESS;
+}
+
+
+/* Solutions of the preprocessed model in CbcMain1 cannot be passed on, the
+   callback then gets the final solution once the search is done */
+
+void CbcNotifyFinalSolution(HCBC hCbc, PPROBLEM pProblem, PSOLVER pSolver)
+{
+	PCBC pCbc = (PCBC)hCbc;
+
+	if (!pSolver->MipSolutionCB || !pProblem->SolveAsMIP || !pCbc->cbc || (pCbc->mipSolutionsSent > 0)) {
+		return;
+	}
+	if (pCbc->cbc->bestSolution() && (pCbc->cbc->getNumCols() == pProblem->ColCount)) {
+		pSolver->MipSolutionCB(pCbc->cbc->getNodeCount(), pCbc->cbc->getObjValue(),
+							   pProblem->ColCount, pCbc->cbc->bestSolution(), pSolver->MipSolutionParam);
+	}
+}
+
+
 int CbcSetAllCallbacks(HCBC hCbc, PSOLVER pSolver, POPTION pOption)
 {
+	PCBC pCbc = (PCBC)hCbc;
 	int logLevel;
 
 	logLevel = coinGetIntOption(pOption, COIN_INT_LOGLEVEL);
 	CbcRegisterMsgLogCallback(hCbc, logLevel, pSolver->MsgLogCB, pSolver->MsgLogParam);
 	CbcRegisterLPIterCallback(hCbc, pSolver->LPIterCB, pSolver->LPIterParam);
+	if (pCbc->iterhandler) {
+		/* handler is passed to the models again by CbcRegisterSolveStats */
+		pCbc->iterhandler->setCallbackFrequency(coinGetIntOption(pOption, COIN_INT_LPITERCBFREQ),
+												coinGetIntOption(pOption, COIN_INT_LPITERCBMSEC));
+	}
 	CbcRegisterMipNodeCallback(hCbc, pSolver->MipNodeCB, pSolver->MipNodeParam);
+	CbcRegisterMipSolutionCallback(hCbc, pSolver->MipSolutionCB, pSolver->MipSolutionParam);
+	return CBC_CALL_SUCCESS;
+}
+
+
+/* The iteration and node handlers are always installed so the presolve
+   phase can be split from the simplex phase and the progress snapshot is
+   kept current, even when no user callback is registered */
+
+int CbcRegisterSolveStats(HCBC hCbc, PRESULT pResult, PSOLVER pSolver)
+{
+	PCBC pCbc = (PCBC)hCbc;
+	OsiClpSolverInterface *osiClp;
+
+	if (!pCbc->iterhandler) {
+		pCbc->iterhandler = new CBIterHandler(pCbc->clp);
+	}
+	pCbc->iterhandler->setSolveStats(pResult);
+	if (!pCbc->cbc) {
+		/* during a MIP the node handler publishes the totals instead */
+		pCbc->iterhandler->setProgress(pSolver);
+	}
+	if (pCbc->clp) pCbc->clp->passInEventHandler(pCbc->iterhandler);
+	if (pCbc->cbc) {
+		osiClp = dynamic_cast<OsiClpSolverInterface*>(pCbc->cbc->solver());
+		if (osiClp) osiClp->getModelPtr()->passInEventHandler(pCbc->iterhandler);
+		if (!pCbc->nodehandler) {
+			pCbc->nodehandler = new CBNodeHandler(pCbc->cbc);
+		}
+		pCbc->nodehandler->setProgress(pSolver);
+		pCbc->cbc->passInEventHandler(pCbc->nodehandler);
+	}
+	return CBC_CALL_SUCCESS;
+}
+
+
+/* Every improving incumbent goes into the pool as it is found, Cbc is
+   also asked to keep its best solutions so non improving ones found by
+   the heuristics can be added after the search */
+
+int CbcRegisterSolutionPool(HCBC hCbc, PPROBLEM pProblem, PRESULT pResult, POPTION pOption)
+{
+	PCBC pCbc = (PCBC)hCbc;
+	int poolSize;
+
+	poolSize = pProblem->SolveAsMIP ? coinGetIntOption(pOption, COIN_INT_SOLUTIONPOOL) : 0;
+	if (!coinInitSolutionPool(pResult, poolSize, pProblem->ColCount)) {
+		return CBC_CALL_FAILED;
+	}
+	if ((poolSize > 0) && pCbc->cbc && pCbc->nodehandler) {
+		pCbc->nodehandler->setSolutionPool(pResult, pProblem->ColCount, pProblem->ObjectSense,
+										   CoinGetTimeOfDay());
+		pCbc->cbc->passInEventHandler(pCbc->nodehandler);
+		pCbc->cbc->setMaximumSavedSolutions(poolSize);
+	}
 	return CBC_CALL_SUCCESS;
 }
 
 
+void CbcCollectSolutionPool(HCBC hCbc, PPROBLEM pProblem, PRESULT pResult, POPTION pOption)
+{
+	PCBC pCbc = (PCBC)hCbc;
+	double foundTime;
+	int i, phase;
+
+	if (!pResult->PoolSize || !pCbc->cbc || (pCbc->cbc->getNumCols() != pProblem->ColCount)) {
+		return;
+	}
+	/* solutions that only show up here are stamped with the end of the search */
+	foundTime = 0.0;
+	for (phase = COIN_PHASE_OPTIONS; phase <= COIN_PHASE_BRANCH; phase++) {
+		foundTime += pResult->Stats.WallTime[phase];
+	}
+	if (pCbc->cbc->bestSolution()) {
+		coinAddPoolSolution(pResult, pProblem->ObjectSense, pCbc->cbc->bestSolution(),
+							pCbc->cbc->getObjValue(), foundTime);
+	}
+	for (i = 0; i < pCbc->cbc->numberSavedSolutions(); i++) {
+		coinAddPoolSolution(pResult, pProblem->ObjectSense, pCbc->cbc->savedSolution(i),
+							pCbc->cbc->savedSolutionObjective(i), foundTime);
+	}
+	coinTrimSolutionPool(pResult, pProblem->ObjectSense, coinGetRealOption(pOption, COIN_REAL_SOLUTIONPOOLGAP));
+}
+
+
+void CbcCollectCutGenStats(HCBC hCbc, PRESULT pResult)
+{
+	PCBC pCbc = (PCBC)hCbc;
+	CbcCutGenerator *generator;
+	double cutTime;
+	int i, count;
+
+	count = pCbc->cbc->numberCutGenerators();
+	if (count > COIN_MAX_CUTGEN) {
+		count = COIN_MAX_CUTGEN;
+	}
+	cutTime = 0.0;
+	for (i = 0; i < count; i++) {
+		generator = pCbc->cbc->cutGenerator(i);
+		strncpy(pResult->Stats.CutGenName[i], generator->cutGeneratorName(), 31);
+		pResult->Stats.CutGenName[i][31] = '\0';
+		pResult->Stats.CutGenTime[i] = generator->timeInCutGenerator();
+		pResult->Stats.CutGenCalls[i] = generator->numberTimesEntered();
+		pResult->Stats.CutGenCuts[i] = generator->numberCutsInTotal();
+		pResult->Stats.CutGenKept[i] = generator->numberCutsActive();
+		pResult->Stats.CutGenColCuts[i] = generator->numberColumnCuts();
+		cutTime += pResult->Stats.CutGenTime[i];
+	}
+	pResult->Stats.CutGenCount = count;
+	/* Cbc does not attribute bound movement to single generators, only the
+	   combined root improvement from all cut passes is available */
+	pResult->Stats.RootCutObjValue = pCbc->cbc->rootObjectiveAfterCuts();
+	/* Cbc only records cpu time per generator, use it for both clocks */
+	pResult->Stats.WallTime[COIN_PHASE_CUTGEN] = cutTime;
+	pResult->Stats.CpuTime[COIN_PHASE_CUTGEN] = cutTime;
+	pResult->Stats.WallTime[COIN_PHASE_BRANCH] -= cutTime;
+	pResult->Stats.CpuTime[COIN_PHASE_BRANCH] -= cutTime;
+	if (pResult->Stats.WallTime[COIN_PHASE_BRANCH] < 0.0) pResult->Stats.WallTime[COIN_PHASE_BRANCH] = 0.0;
+	if (pResult->Stats.CpuTime[COIN_PHASE_BRANCH] < 0.0) pResult->Stats.CpuTime[COIN_PHASE_BRANCH] = 0.0;
+}
+
+
+void CbcLogCutGenStats(PSOLVER pSolver, PRESULT pResult)
+{
+	char logstr[200];
+	int i;
+
+	if (!pSolver->MsgLogCB || (pResult->Stats.CutGenCount == 0)) {
+		return;
+	}
+	for (i = 0; i < pResult->Stats.CutGenCount; i++) {
+		sprintf(logstr, "Cut generator %-12s %7d calls %8d cuts %8d kept %6d column cuts %9.3f seconds",
+				pResult->Stats.CutGenName[i], pResult->Stats.CutGenCalls[i],
+				pResult->Stats.CutGenCuts[i], pResult->Stats.CutGenKept[i],
+				pResult->Stats.CutGenColCuts[i], pResult->Stats.CutGenTime[i]);
+		pSolver->MsgLogCB(logstr, pSolver->MsgLogParam);
+	}
+	sprintf(logstr, "Root objective %g before cuts, %g after cuts",
+			pResult->Stats.RootLPObjValue, pResult->Stats.RootCutObjValue);
+	pSolver->MsgLogCB(logstr, pSolver->MsgLogParam);
+}
+
+
 
 /************************************************************************/
 /*  Option Setting                                                      */
@@ -584,6 +1284,7 @@ int CbcSetClpOptions(HCBC hCbc, POPTION pOption)
 	ClpSolve::PresolveType presolve;
 
 	/* check if it has been changed, leave alone otherwise */
+	if (coinGetOptionChanged(pOption, COIN_INT_LOGLEVEL))			pCbc->clp->setLogLevel(coinGetIntOption(pOption, COIN_INT_LOGLEVEL));
 	if (coinGetOptionChanged(pOption, COIN_INT_SCALING))			pCbc->clp->scaling(coinGetIntOption(pOption, COIN_INT_SCALING));
 	if (coinGetOptionChanged(pOption, COIN_INT_PERTURBATION))		pCbc->clp->setPerturbation(coinGetIntOption(pOption, COIN_INT_PERTURBATION));
 
@@ -626,6 +1327,9 @@ int CbcSetClpOptions(HCBC hCbc, POPTION pOption)
 	}
 
 	if (coinGetOptionChanged(pOption, COIN_INT_PRESOLVETYPE)) {
+		if (!pCbc->clp_presolve) {
+			pCbc->clp_presolve = new ClpSolve();
+		}
 		switch (coinGetIntOption(pOption, COIN_INT_PRESOLVETYPE)) {
 			case 0: presolve = ClpSolve::presolveOn;		 break;
 			case 1: presolve = ClpSolve::presolveOff;		 break;
@@ -645,6 +1349,7 @@ int CbcSetCbcOptions(HCBC hCbc, POPTION pOption)
 	if (!pCbc->cbc) {
 		return 0;
 	}
+	if (coinGetOptionChanged(pOption, COIN_INT_LOGLEVEL))			pCbc->cbc->setLogLevel(coinGetIntOption(pOption, COIN_INT_LOGLEVEL));
 	if (coinGetOptionChanged(pOption, COIN_INT_MIPMAXNODES))		pCbc->cbc->setMaximumNodes(coinGetIntOption(pOption, COIN_INT_MIPMAXNODES));
 	if (coinGetOptionChanged(pOption, COIN_INT_MIPMAXSOL))		pCbc->cbc->setMaximumSolutions(coinGetIntOption(pOption, COIN_INT_MIPMAXSOL));
 	if (coinGetOptionChanged(pOption, COIN_REAL_MIPMAXSEC))		pCbc->cbc->setDblParam(CbcModel::CbcMaximumSeconds,coinGetRealOption(pOption, COIN_REAL_MIPMAXSEC));
@@ -669,65 +1374,147 @@ int CbcSetCbcOptions(HCBC hCbc, POPTION pOption)
 }
 
 
-int CbcSetCglOptions(HCBC hCbc, POPTION pOption)
+/* The cut generators are kept with the solver between solves and only
+   recreated when an option has been changed since they were configured.
+   CbcModel::addCutGenerator works on a clone, so each solve starts from
+   the configured generator state. */
+
+PCUTGEN CbcCreateCutGenerators(POPTION pOption)
 {
-	PCBC pCbc = (PCBC)hCbc;
+	PCUTGEN pCutGen;
+
+	pCutGen = (PCUTGEN)malloc(sizeof(CUTGENINFO));
+	if (!pCutGen) {
+		return NULL;
+	}
+	memset(pCutGen, 0, sizeof(CUTGENINFO));
+	pCutGen->OptionChangeCount = coinGetOptionChangeCount(pOption);
 
 	/* see CbcModel.hpp has commments on calling cuts */
 	if (coinGetIntOption(pOption, COIN_INT_MIPCUT_PROBING)) {
-		pCbc->probing = new CglProbing();
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_MODE))	pCbc->probing->setMode(coinGetIntOption(pOption, COIN_INT_MIPPROBE_MODE));
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_USEOBJ))	pCbc->probing->setUsingObjective(coinGetIntOption(pOption, COIN_INT_MIPPROBE_USEOBJ) ? true : false);
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_MAXPASS))	pCbc->probing->setMaxPass(coinGetIntOption(pOption, COIN_INT_MIPPROBE_MAXPASS));
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_MAXPROBE))	pCbc->probing->setMaxProbe(coinGetIntOption(pOption, COIN_INT_MIPPROBE_MAXPROBE));
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_MAXLOOK))	pCbc->probing->setMaxLook(coinGetIntOption(pOption, COIN_INT_MIPPROBE_MAXLOOK));
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_ROWCUTS))	pCbc->probing->setRowCuts(coinGetIntOption(pOption, COIN_INT_MIPPROBE_ROWCUTS));
-		pCbc->cbc->addCutGenerator(pCbc->probing,coinGetIntOption(pOption, COIN_INT_MIPPROBE_FREQ),"Probing");
+		pCutGen->probing = new CglProbing();
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_MODE))	pCutGen->probing->setMode(coinGetIntOption(pOption, COIN_INT_MIPPROBE_MODE));
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_USEOBJ))	pCutGen->probing->setUsingObjective(coinGetIntOption(pOption, COIN_INT_MIPPROBE_USEOBJ) ? true : false);
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_MAXPASS))	pCutGen->probing->setMaxPass(coinGetIntOption(pOption, COIN_INT_MIPPROBE_MAXPASS));
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_MAXPROBE))	pCutGen->probing->setMaxProbe(coinGetIntOption(pOption, COIN_INT_MIPPROBE_MAXPROBE));
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_MAXLOOK))	pCutGen->probing->setMaxLook(coinGetIntOption(pOption, COIN_INT_MIPPROBE_MAXLOOK));
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPPROBE_ROWCUTS))	pCutGen->probing->setRowCuts(coinGetIntOption(pOption, COIN_INT_MIPPROBE_ROWCUTS));
 	}
 
 	if (coinGetIntOption(pOption, COIN_INT_MIPCUT_GOMORY)) {
-		pCbc->gomory = new CglGomory();
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPGOMORY_LIMIT))	pCbc->gomory->setLimit(coinGetIntOption(pOption, COIN_INT_MIPGOMORY_LIMIT));
-		if (coinGetOptionChanged(pOption, COIN_REAL_MIPGOMORY_AWAY))	pCbc->gomory->setAway(coinGetRealOption(pOption, COIN_REAL_MIPGOMORY_AWAY));
-		pCbc->cbc->addCutGenerator(pCbc->gomory,coinGetIntOption(pOption, COIN_INT_MIPGOMORY_FREQ),"Gomory");
+		pCutGen->gomory = new CglGomory();
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPGOMORY_LIMIT))	pCutGen->gomory->setLimit(coinGetIntOption(pOption, COIN_INT_MIPGOMORY_LIMIT));
+		if (coinGetOptionChanged(pOption, COIN_REAL_MIPGOMORY_AWAY))	pCutGen->gomory->setAway(coinGetRealOption(pOption, COIN_REAL_MIPGOMORY_AWAY));
 	}
 
 	if (coinGetIntOption(pOption, COIN_INT_MIPCUT_KNAPSACK)) {
-		pCbc->knapsack = new CglKnapsackCover();
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPKNAPSACK_MAXIN))	pCbc->knapsack->setMaxInKnapsack(coinGetIntOption(pOption, COIN_INT_MIPKNAPSACK_MAXIN));
-		pCbc->cbc->addCutGenerator(pCbc->knapsack,coinGetIntOption(pOption, COIN_INT_MIPKNAPSACK_FREQ),"Knapsack");
+		pCutGen->knapsack = new CglKnapsackCover();
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPKNAPSACK_MAXIN))	pCutGen->knapsack->setMaxInKnapsack(coinGetIntOption(pOption, COIN_INT_MIPKNAPSACK_MAXIN));
 	}
 
 	if (coinGetIntOption(pOption, COIN_INT_MIPCUT_ODDHOLE)) {
-		pCbc->oddhole= new CglOddHole();
-		if (coinGetOptionChanged(pOption, COIN_REAL_MIPODDHOLE_MINVIOL))	pCbc->oddhole->setMinimumViolation(coinGetRealOption(pOption, COIN_REAL_MIPODDHOLE_MINVIOL));
-		if (coinGetOptionChanged(pOption, COIN_REAL_MIPODDHOLE_MINVIOLPER))	pCbc->oddhole->setMinimumViolationPer(coinGetRealOption(pOption, COIN_REAL_MIPODDHOLE_MINVIOLPER));
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPODDHOLE_MAXENTRIES))	pCbc->oddhole->setMaximumEntries(coinGetIntOption(pOption, COIN_INT_MIPODDHOLE_MAXENTRIES));
-		pCbc->cbc->addCutGenerator(pCbc->oddhole,coinGetIntOption(pOption, COIN_INT_MIPODDHOLE_FREQ),"OddHole");
+		pCutGen->oddhole= new CglOddHole();
+		if (coinGetOptionChanged(pOption, COIN_REAL_MIPODDHOLE_MINVIOL))	pCutGen->oddhole->setMinimumViolation(coinGetRealOption(pOption, COIN_REAL_MIPODDHOLE_MINVIOL));
+		if (coinGetOptionChanged(pOption, COIN_REAL_MIPODDHOLE_MINVIOLPER))	pCutGen->oddhole->setMinimumViolationPer(coinGetRealOption(pOption, COIN_REAL_MIPODDHOLE_MINVIOLPER));
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPODDHOLE_MAXENTRIES))	pCutGen->oddhole->setMaximumEntries(coinGetIntOption(pOption, COIN_INT_MIPODDHOLE_MAXENTRIES));
 	}
 
 	if (coinGetIntOption(pOption, COIN_INT_MIPCUT_CLIQUE)) {
-		pCbc->clique= new CglClique(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_PACKING) ? true : false);
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_STAR))		pCbc->clique->setDoStarClique(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_STAR) ? true : false);
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_STARMETHOD))	pCbc->clique->setStarCliqueNextNodeMethod((CglClique::scl_next_node_method)coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_STARMETHOD));
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_STARMAXLEN))	pCbc->clique->setStarCliqueCandidateLengthThreshold(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_STARMAXLEN));
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_STARREPORT))	pCbc->clique->setStarCliqueReport(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_STARREPORT) ? true : false);
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_ROW))		pCbc->clique->setDoRowClique(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_ROW) ? true : false);
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_ROWMAXLEN))	pCbc->clique->setRowCliqueCandidateLengthThreshold(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_ROWMAXLEN));
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_ROWREPORT))	pCbc->clique->setRowCliqueReport(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_ROWREPORT) ? true : false);
-		if (coinGetOptionChanged(pOption, COIN_REAL_MIPCLIQUE_MINVIOL))	pCbc->clique->setMinViolation(coinGetRealOption(pOption, COIN_REAL_MIPCLIQUE_MINVIOL));
-		pCbc->cbc->addCutGenerator(pCbc->clique,coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_FREQ),"Clique");
+		pCutGen->clique= new CglClique(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_PACKING) ? true : false);
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_STAR))		pCutGen->clique->setDoStarClique(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_STAR) ? true : false);
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_STARMETHOD))	pCutGen->clique->setStarCliqueNextNodeMethod((CglClique::scl_next_node_method)coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_STARMETHOD));
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_STARMAXLEN))	pCutGen->clique->setStarCliqueCandidateLengthThreshold(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_STARMAXLEN));
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_STARREPORT))	pCutGen->clique->setStarCliqueReport(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_STARREPORT) ? true : false);
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_ROW))		pCutGen->clique->setDoRowClique(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_ROW) ? true : false);
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_ROWMAXLEN))	pCutGen->clique->setRowCliqueCandidateLengthThreshold(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_ROWMAXLEN));
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPCLIQUE_ROWREPORT))	pCutGen->clique->setRowCliqueReport(coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_ROWREPORT) ? true : false);
+		if (coinGetOptionChanged(pOption, COIN_REAL_MIPCLIQUE_MINVIOL))	pCutGen->clique->setMinViolation(coinGetRealOption(pOption, COIN_REAL_MIPCLIQUE_MINVIOL));
 	}
 
 	if (coinGetIntOption(pOption, COIN_INT_MIPCUT_LIFTPROJECT)) {
-		pCbc->liftpro = new CglLiftAndProject();
-		if (coinGetOptionChanged(pOption, COIN_INT_MIPLIFTPRO_BETAONE))	pCbc->liftpro->setBeta(coinGetIntOption(pOption, COIN_INT_MIPLIFTPRO_BETAONE) ? 1 : -1);
-		pCbc->cbc->addCutGenerator(pCbc->liftpro,coinGetIntOption(pOption, COIN_INT_MIPLIFTPRO_FREQ),"LiftProject");
+		pCutGen->liftpro = new CglLiftAndProject();
+		if (coinGetOptionChanged(pOption, COIN_INT_MIPLIFTPRO_BETAONE))	pCutGen->liftpro->setBeta(coinGetIntOption(pOption, COIN_INT_MIPLIFTPRO_BETAONE) ? 1 : -1);
 	}
 
 	if (coinGetIntOption(pOption, COIN_INT_MIPCUT_SIMPROUND)) {
-		pCbc->rounding = new CglSimpleRounding();
-		pCbc->cbc->addCutGenerator(pCbc->rounding,coinGetIntOption(pOption, COIN_INT_MIPSIMPROUND_FREQ),"Rounding");
+		pCutGen->rounding = new CglSimpleRounding();
+	}
+	return pCutGen;
+}
+
+
+void CbcFreeCutGenerators(PSOLVER pSolver)
+{
+	PCUTGEN pCutGen = (PCUTGEN)pSolver->CutGenerators;
+
+	if (!pCutGen) {
+		return;
+	}
+	if (pCutGen->probing)	delete pCutGen->probing;
+	if (pCutGen->gomory)	delete pCutGen->gomory;
+	if (pCutGen->knapsack)	delete pCutGen->knapsack;
+	if (pCutGen->oddhole)	delete pCutGen->oddhole;
+	if (pCutGen->clique)	delete pCutGen->clique;
+	if (pCutGen->liftpro)	delete pCutGen->liftpro;
+	if (pCutGen->rounding)	delete pCutGen->rounding;
+	free(pCutGen);
+	pSolver->CutGenerators = NULL;
+}
+
+
+int CbcSetCglOptions(HCBC hCbc, PSOLVER pSolver, POPTION pOption)
+{
+	PCBC pCbc = (PCBC)hCbc;
+	PCUTGEN pCutGen = (PCUTGEN)pSolver->CutGenerators;
+
+	if (pCutGen && (pCutGen->OptionChangeCount != coinGetOptionChangeCount(pOption))) {
+		CbcFreeCutGenerators(pSolver);
+		pCutGen = NULL;
+	}
+	if (!pCutGen) {
+		pCutGen = CbcCreateCutGenerators(pOption);
+		if (!pCutGen) {
+			return 0;
+		}
+		pSolver->CutGenerators = pCutGen;
+	}
+	if (pCutGen->probing)	pCbc->cbc->addCutGenerator(pCutGen->probing,coinGetIntOption(pOption, COIN_INT_MIPPROBE_FREQ),"Probing");
+	if (pCutGen->gomory)	pCbc->cbc->addCutGenerator(pCutGen->gomory,coinGetIntOption(pOption, COIN_INT_MIPGOMORY_FREQ),"Gomory");
+	if (pCutGen->knapsack)	pCbc->cbc->addCutGenerator(pCutGen->knapsack,coinGetIntOption(pOption, COIN_INT_MIPKNAPSACK_FREQ),"Knapsack");
+	if (pCutGen->oddhole)	pCbc->cbc->addCutGenerator(pCutGen->oddhole,coinGetIntOption(pOption, COIN_INT_MIPODDHOLE_FREQ),"OddHole");
+	if (pCutGen->clique)	pCbc->cbc->addCutGenerator(pCutGen->clique,coinGetIntOption(pOption, COIN_INT_MIPCLIQUE_FREQ),"Clique");
+	if (pCutGen->liftpro)	pCbc->cbc->addCutGenerator(pCutGen->liftpro,coinGetIntOption(pOption, COIN_INT_MIPLIFTPRO_FREQ),"LiftProject");
+	if (pCutGen->rounding)	pCbc->cbc->addCutGenerator(pCutGen->rounding,coinGetIntOption(pOption, COIN_INT_MIPSIMPROUND_FREQ),"Rounding");
+	return 1;
+}
+
+
+/* The lazy generator runs at every node and at every solution, also after
+   a round that found other cuts.  The separator runs in the cut rounds at
+   the user cut frequency.  Both put their cuts in the global cut pool.
+   CbcModel keeps its own clones, the local objects are only templates. */
+
+int CbcAddUserCutGenerators(HCBC hCbc, PPROBLEM pProblem, PSOLVER pSolver, POPTION pOption)
+{
+	PCBC pCbc = (PCBC)hCbc;
+	CbcCutGenerator *generator;
+	double intTolerance;
+
+	intTolerance = coinGetRealOption(pOption, COIN_REAL_MIPINTTOL);
+	if (pSolver->UserCutCB) {
+		CBUserCuts userCuts(pProblem, intTolerance);
+		userCuts.registerCutCallback(pSolver->UserCutCB, pSolver->UserCutParam);
+		pCbc->cbc->addCutGenerator(&userCuts, coinGetIntOption(pOption, COIN_INT_MIPUSERCUT_FREQ), "UserCuts");
+		generator = pCbc->cbc->cutGenerator(pCbc->cbc->numberCutGenerators() - 1);
+		generator->setGlobalCuts(true);
+	}
+	if (pSolver->LazyConCB) {
+		CBUserCuts lazyCuts(pProblem, intTolerance);
+		lazyCuts.registerLazyCallback(pSolver->LazyConCB, pSolver->LazyConParam);
+		pCbc->cbc->addCutGenerator(&lazyCuts, 1, "Lazy", true, true);
+		generator = pCbc->cbc->cutGenerator(pCbc->cbc->numberCutGenerators() - 1);
+		generator->setMustCallAgain(true);
+		generator->setGlobalCuts(true);
 	}
 	return 1;
 }
@@ -764,41 +1551,79 @@ void CbcCopyNamesList(HCBC hCbc, PPROBLEM pProblem)
 }
 
 
+/* The integer columns are marked with one call per solver interface
+   instead of one virtual call per column */
+
 int CbcSetColumnIntegers(HCBC hCbc, PPROBLEM pProblem)
 {
-	int i;
+	int *intIndex;
+	int i, k;
 	PCBC pCbc = (PCBC)hCbc;
 
 	if (pProblem->numInts == 0) {
 		return CBC_CALL_FAILED;
 	}
+	intIndex = (int *)malloc(pProblem->numInts * sizeof(int));
+	if (!intIndex) {
+		return CBC_CALL_FAILED;
+	}
+	k = 0;
 	for (i = 0; i < pProblem->ColCount; i++) {
 		if (pProblem->IsInt[i]) {
-			pCbc->cbc->solver()->setInteger(i);
-			pCbc->osi->setInteger(i);
+			intIndex[k++] = i;
 		}
 	}
+	pCbc->cbc->solver()->setInteger(intIndex, k);
+	pCbc->osi->setInteger(intIndex, k);
+	free(intIndex);
 	return CBC_CALL_SUCCESS;
 }
 
 
+/* Directions go to the CbcSimpleInteger objects, these are created by
+   passInPriorities or otherwise by findIntegers.  CbcMain1 carries the
+   objects of the model through its preprocessing, so the hints hold in both
+   solve paths. */
+
+static void CbcSetPreferredWays(HCBC hCbc, const int* branchVar)
+{
+	PCBC pCbc = (PCBC)hCbc;
+	CbcSimpleInteger *intObject;
+	int i, col;
+
+	for (i = 0; i < pCbc->cbc->numberObjects(); i++) {
+		intObject = dynamic_cast<CbcSimpleInteger *>(pCbc->cbc->objects()[i]);
+		if (!intObject) {
+			continue;
+		}
+		col = intObject->columnNumber();
+		if (branchVar[col] != 0) {
+			intObject->setPreferredWay((branchVar[col] > 0) ? 1 : -1);
+		}
+	}
+}
+
+
 int CbcAddPriorObjects(HCBC hCbc, PPROBLEM pProblem)
 {
 	int *priorVar;
+	int *branchVar;
 	int *priorCbc;
 	int i,k;
 	PCBC pCbc = (PCBC)hCbc;
 
-	if ((pProblem->PriorCount == 0) || (pProblem->numInts == 0)) {
+	if ((pProblem->PriorCount == 0) || (pProblem->numInts == 0) || !pProblem->PriorIndex) {
 		return CBC_CALL_FAILED;
 	}
-	priorVar = (int *)malloc(pProblem->ColCount * sizeof(int));
+	priorVar = (int *)malloc(2 * pProblem->ColCount * sizeof(int));
 	if (!priorVar) {
 		return CBC_CALL_FAILED;
 	}
+	branchVar = &priorVar[pProblem->ColCount];
 	//reset the priorVar
 	for (i = 0; i < pProblem->ColCount; i++) {
 		priorVar[i] = 1000;
+		branchVar[i] = 0;
 	}
 	for (i = 0; i < pProblem->PriorCount; i++) {
 		if ((pProblem->PriorIndex[i] < 0) ||
@@ -806,51 +1631,78 @@ int CbcAddPriorObjects(HCBC hCbc, PPROBLEM pProblem)
 			free(priorVar);
 			return CBC_CALL_FAILED;
 		}
-		priorVar[pProblem->PriorIndex[i]] = pProblem->PriorValues[i];
+		if (pProblem->PriorValues) priorVar[pProblem->PriorIndex[i]] = pProblem->PriorValues[i];
+		if (pProblem->PriorBranch) branchVar[pProblem->PriorIndex[i]] = pProblem->PriorBranch[i];
 	}
-	//Create an array to give to cbc
-	priorCbc = (int *)malloc(pProblem->numInts * sizeof(int));
-	if (!priorCbc) {
-		free(priorVar);
-		return CBC_CALL_FAILED;
-	}
-	k = 0;
-	for (i = 0; i < pProblem->ColCount; i++) {
-		if (pProblem->IsInt[i]) {
-			priorCbc[k++] = priorVar[i];
+	if (pProblem->PriorValues) {
+		//Create an array to give to cbc
+		priorCbc = (int *)malloc(pProblem->numInts * sizeof(int));
+		if (!priorCbc) {
+			free(priorVar);
+			return CBC_CALL_FAILED;
+		}
+		k = 0;
+		for (i = 0; i < pProblem->ColCount; i++) {
+			if (pProblem->IsInt[i]) {
+				priorCbc[k++] = priorVar[i];
+			}
 		}
+		pCbc->cbc->passInPriorities(priorCbc, false);
+		free(priorCbc);
+	}
+	else if (pCbc->cbc->numberObjects() == 0) {
+		pCbc->cbc->findIntegers(false);
+	}
+	if (pProblem->PriorBranch) {
+		CbcSetPreferredWays(hCbc, branchVar);
 	}
-	pCbc->cbc->passInPriorities(priorCbc, false);
-	free(priorCbc);
 	free(priorVar);
 	return CBC_CALL_SUCCESS;
 }
 
 
+/* SosRef gives the reference weights that order the members, without it
+   CbcSOS numbers them in the given order.  All sets go to the model in one
+   addObjects call, which clones them. */
+
 int CbcAddSosObjects(HCBC hCbc, PPROBLEM pProblem)
 {
-	int sos, count;
-	int* which;
-	int type;
+	CbcObject **sosObjects;
+	int sos, count, begin;
 	PCBC pCbc = (PCBC)hCbc;
 
 	if (pProblem->SosCount == 0) {
 		return CBC_CALL_FAILED;
 	}
+	sosObjects = (CbcObject **)malloc(pProblem->SosCount * sizeof(CbcObject *));
+	if (!sosObjects) {
+		return CBC_CALL_FAILED;
+	}
+	for (sos = 0; sos < pProblem->SosCount; sos++) {
+		begin = pProblem->SosBegin[sos];
+		count = pProblem->SosBegin[sos+1] - begin;
+		sosObjects[sos] = new CbcSOS(pCbc->cbc, count, &pProblem->SosIndex[begin],
+									 pProblem->SosRef ? &pProblem->SosRef[begin] : NULL,
+									 sos, pProblem->SosType[sos]);
+		if (pProblem->SosPrior) {
+			sosObjects[sos]->setPriority(pProblem->SosPrior[sos]);
+		}
+	}
+	pCbc->cbc->addObjects(pProblem->SosCount, sosObjects);
 	for (sos = 0; sos < pProblem->SosCount; sos++) {
-		count = pProblem->SosBegin[sos+1] - pProblem->SosBegin[sos];
-		which = &pProblem->SosIndex[pProblem->SosBegin[sos]];
-		type = pProblem->SosType[sos];
-		CbcObject *sosObject = new CbcSOS(pCbc->cbc, count, which, NULL, 0, type);
-		pCbc->cbc->addObjects(1, &sosObject);
-		delete sosObject;
+		delete sosObjects[sos];
 	}
+	free(sosObjects);
 	return CBC_CALL_SUCCESS;
 }
 
 
+/* Each semi-continuous column is a lot-size object with the ranges
+   [0, 0] and [lower, upper], all go to the model in one addObjects call */
+
 int CbcAddSemiContObjects(HCBC hCbc, PPROBLEM pProblem)
 {
+	CbcObject **semiObjects;
 	double points[4];
 	int i, semicol;
 	PCBC pCbc = (PCBC)hCbc;
@@ -858,16 +1710,23 @@ int CbcAddSemiContObjects(HCBC hCbc, PPROBLEM pProblem)
 	if (pProblem->SemiCount == 0) {
 		return CBC_CALL_FAILED;
 	}
+	semiObjects = (CbcObject **)malloc(pProblem->SemiCount * sizeof(CbcObject *));
+	if (!semiObjects) {
+		return CBC_CALL_FAILED;
+	}
 	points[0] = 0.0;
 	points[1] = 0.0;
 	for (i = 0; i < pProblem->SemiCount; i++ ) {
 		semicol = pProblem->SemiIndex[i];
 		points[2] = pProblem->LowerBounds[semicol];
 		points[3] = pProblem->UpperBounds[semicol];
-		CbcObject *semiObject = new CbcLotsize(pCbc->cbc, semicol, 2, points, true);
-		pCbc->cbc->addObjects(1, &semiObject);
-		delete semiObject;
+		semiObjects[i] = new CbcLotsize(pCbc->cbc, semicol, 2, points, true);
 	}
+	pCbc->cbc->addObjects(pProblem->SemiCount, semiObjects);
+	for (i = 0; i < pProblem->SemiCount; i++ ) {
+		delete semiObjects[i];
+	}
+	free(semiObjects);
 	return CBC_CALL_SUCCESS;
 }
 
@@ -900,10 +1759,14 @@ int CbcLoadAllSolverObjects(HCBC hCbc, PPROBLEM pProblem)
 		memcpy(pProblem->LowerBounds, storeLowerBound, pProblem->ColCount * sizeof(double));
 		free(storeLowerBound);
 	}
+	if (pProblem->QuadNZCount > 0) {
+		pCbc->clp->loadQuadraticObjective(pProblem->ColCount, pProblem->QuadBegin,
+							pProblem->QuadIndex, pProblem->QuadValues);
+	}
 	CbcCopyNamesList(hCbc, pProblem);
 	if (pProblem->SolveAsMIP) {
 		if (!pCbc->cbc) {
-			pCbc->cbc = new CbcModel(*pCbc->osi);
+			pCbc->cbc = new CbcModel(*CbcGetOsiSolver(hCbc));
 		}
 		result = CbcSetColumnIntegers(hCbc, pProblem);
 		result = CbcAddPriorObjects(hCbc, pProblem);
@@ -915,31 +1778,195 @@ int CbcLoadAllSolverObjects(HCBC hCbc, PPROBLEM pProblem)
 
 
 
+/************************************************************************/
+/*  Presolve Cache                                                      */
+/************************************************************************/
+
+/* Presolved models and their postsolve information only hold for the
+   exact data they were built from, so for problems that repeat their
+   structure with new data the final basis is cached instead.  It is keyed
+   on the structural fingerprint of the problem, a repeat solve loads the
+   basis and goes straight to dual simplex without presolve.  A fingerprint
+   collision only gives a poor starting basis, never a wrong answer. */
+
+static PCACHE BasisCache = NULL;
+
+
+void CbcInitSolver(void)
+{
+	if (!BasisCache) {
+		BasisCache = coinCreateCache(0);
+	}
+}
+
+
+void CbcFreeSolver(void)
+{
+	coinClearCache(BasisCache);
+	BasisCache = NULL;
+}
+
+
+/* The fingerprint is only computed when a basis is cached, once the
+   problem passed the checks so that a malformed matrix is never walked */
+
+int CbcGetBasisKey(PPROBLEM pProblem, PCACHEKEY pKey)
+{
+	CHECKINFO check;
+
+	if (!pProblem->HasFingerprint) {
+		if (coinCheckProblem(pProblem, &check) != 0) {
+			return 0;
+		}
+		coinComputeFingerprint(pProblem);
+	}
+	coinInitCacheKey(pKey);
+	coinHashCacheKey(pKey, pProblem->Fingerprint, sizeof(pProblem->Fingerprint));
+	coinFinishCacheKey(pKey, pProblem->ColCount, pProblem->RowCount, pProblem->NZCount, 0);
+	return 1;
+}
+
+
+int CbcLoadCachedBasis(HCBC hCbc, PPROBLEM pProblem, POPTION pOption)
+{
+	PCBC pCbc = (PCBC)hCbc;
+	CACHEKEY key;
+	void* status;
+	int statusSize;
+
+	if (!BasisCache || (coinGetIntOption(pOption, COIN_INT_BASISCACHE) == 0)) {
+		return 0;
+	}
+	if (!CbcGetBasisKey(pProblem, &key) ||
+		!coinCacheFetch(BasisCache, &key, &status, &statusSize)) {
+		return 0;
+	}
+	if (statusSize != pProblem->ColCount + pProblem->RowCount) {
+		free(status);
+		return 0;
+	}
+	pCbc->clp->copyinStatus((unsigned char*)status);
+	free(status);
+	return 1;
+}
+
+
+void CbcStoreCachedBasis(HCBC hCbc, PPROBLEM pProblem, POPTION pOption)
+{
+	PCBC pCbc = (PCBC)hCbc;
+	CACHEKEY key;
+	int cacheSize;
+
+	cacheSize = coinGetIntOption(pOption, COIN_INT_BASISCACHE);
+	if (!BasisCache || (cacheSize == 0) || (pCbc->clp->status() != 0) || !pCbc->clp->statusExists() ||
+		!CbcGetBasisKey(pProblem, &key)) {
+		return;
+	}
+	coinSetCacheSize(BasisCache, cacheSize);
+	coinCacheStore(BasisCache, &key, pCbc->clp->statusArray(), pProblem->ColCount + pProblem->RowCount);
+}
+
+
+
 //extern int CbcOrClpRead_mode;
 
-int CbcSolveProblem(HCBC hCbc, PPROBLEM pProblem, POPTION pOption, int Method)
+void CbcInitialSolve(HCBC hCbc, PPROBLEM pProblem, PRESULT pResult, POPTION pOption)
 {
 	PCBC pCbc = (PCBC)hCbc;
 
+	CbcStartPhase(pResult, COIN_PHASE_PRESOLVE);
+	if (pProblem->SolveAsMIP) {
+		pCbc->cbc->initialSolve();
+		}
+	else if (pProblem->QuadNZCount > 0) {
+		/* dual simplex has no quadratic objectives, barrier if chosen and
+		   otherwise the primal QP simplex */
+		ClpSolve qpSolve;
+		switch (coinGetIntOption(pOption, COIN_INT_SOLVEMETHOD)) {
+			case 3:  qpSolve.setSolveType(ClpSolve::useBarrier);		break;
+			case 4:  qpSolve.setSolveType(ClpSolve::useBarrierNoCross);	break;
+			default: qpSolve.setSolveType(ClpSolve::usePrimal);
+		}
+		if (coinGetOptionChanged(pOption, COIN_INT_PRESOLVETYPE) &&
+			(coinGetIntOption(pOption, COIN_INT_PRESOLVETYPE) == 1)) {
+			qpSolve.setPresolveType(ClpSolve::presolveOff);
+		}
+		pCbc->clp->initialSolve(qpSolve);
+		}
+	else if (CbcLoadCachedBasis(hCbc, pProblem, pOption)) {
+		ClpSolve warmSolve;
+		warmSolve.setPresolveType(ClpSolve::presolveOff);
+		warmSolve.setSolveType(ClpSolve::useDual);
+		pCbc->clp->initialSolve(warmSolve);
+		}
+	else if (coinGetOptionChanged(pOption, COIN_INT_PRESOLVETYPE))
+		pCbc->clp->initialSolve(*pCbc->clp_presolve);
+	else {
+		pCbc->clp->initialSolve();
+	}
+	/* no iteration event means the whole solve was spent in presolve */
+	CbcStopPhase(pResult, COIN_PHASE_PRESOLVE);
+	CbcStopPhase(pResult, COIN_PHASE_LPSOLVE);
+	if (!pProblem->SolveAsMIP && (pProblem->QuadNZCount == 0)) {
+		CbcStoreCachedBasis(hCbc, pProblem, pOption);
+	}
+}
+
+
+/* CbcModel keeps a clone of the heuristic, the local object is only the
+   template */
+
+int CbcAddUserHeuristic(HCBC hCbc, PSOLVER pSolver, POPTION pOption)
+{
+	PCBC pCbc = (PCBC)hCbc;
+
+	if (!pSolver->HeuristicCB) {
+		return 0;
+	}
+	CBUserHeuristic userHeuristic(*pCbc->cbc, pSolver->HeuristicCB, pSolver->HeuristicParam,
+								  coinGetIntOption(pOption, COIN_INT_MIPUSERHEUR_FREQ));
+	userHeuristic.setHeuristicName("UserHeuristic");
+	pCbc->cbc->addHeuristic(&userHeuristic, "UserHeuristic");
+	return 1;
+}
+
+
+/* CbcMain1 preprocesses the model into other columns and sets up its own
+   generators and heuristics, the user callbacks that work on the columns
+   of the search need the plain branchAndBound */
+
+static int CbcHasSearchCallbacks(PSOLVER pSolver)
+{
+	return (pSolver->LazyConCB || pSolver->UserCutCB || pSolver->HeuristicCB) ? 1 : 0;
+}
+
+
+int CbcSolveProblem(HCBC hCbc, PPROBLEM pProblem, PRESULT pResult, PSOLVER pSolver, POPTION pOption, int Method)
+{
+	PCBC pCbc = (PCBC)hCbc;
+	int i;
+
 	if (!pProblem->SolveAsMIP) {
+		CbcStartPhase(pResult, COIN_PHASE_OPTIONS);
 		CbcSetClpOptions(hCbc, pOption);
-		if (coinGetOptionChanged(pOption, COIN_INT_PRESOLVETYPE))
-			pCbc->clp->initialSolve(*pCbc->clp_presolve);
-		else {
-			pCbc->clp->initialSolve();
-		}
+		CbcStopPhase(pResult, COIN_PHASE_OPTIONS);
+		CbcInitialSolve(hCbc, pProblem, pResult, pOption);
 		}
 	else {
 #ifdef NEW_STYLE_CBCMAIN
-		if (coinGetIntOption(pOption, COIN_INT_MIPUSECBCMAIN)) {
+		if (coinGetIntOption(pOption, COIN_INT_MIPUSECBCMAIN) && !CbcHasSearchCallbacks(pSolver)) {
 			CbcSolverUsefulData parameterData;
 			parameterData.noPrinting_ = true;
+			CbcStartPhase(pResult, COIN_PHASE_OPTIONS);
 			CbcMain0(*pCbc->cbc, parameterData);
 			CbcSetClpOptions(hCbc, pOption);
 			CbcSetCbcOptions(hCbc, pOption);
+			CbcStopPhase(pResult, COIN_PHASE_OPTIONS);
 			//CbcSetCglOptions(hProb);  BK: CbcMain1 will call the Cgl's automatically
 			//CbcOrClpRead_mode = 1;  // BK: Fix bug in CbcMain1, CbcOrClpRead_mode not initialized  (CpcSolver.cpp, stable 2.2)
 			int logLevel = coinGetIntOption(pOption, COIN_INT_LOGLEVEL);
+			/* CbcMain1 runs presolve, root and search as one call */
+			CbcStartPhase(pResult, COIN_PHASE_BRANCH);
 			if (logLevel == 1) {
 				const int argc = 3;
 				const char* argv[] = {"CoinMP", "-solve", "-quit"};
@@ -952,30 +1979,50 @@ int CbcSolveProblem(HCBC hCbc, PPROBLEM pProblem, POPTION pOption, int Method)
 				const char* argv[] = {"CoinMP", "-log", logstr, "-solve", "-quit"};
 				CbcMain1(argc, argv, *pCbc->cbc, parameterData);
 			}
+			CbcStopPhase(pResult, COIN_PHASE_BRANCH);
 			}
 		else
 #endif
 		{
+			CbcStartPhase(pResult, COIN_PHASE_OPTIONS);
 			CbcSetClpOptions(hCbc, pOption);
 			CbcSetCbcOptions(hCbc, pOption);
-			CbcSetCglOptions(hCbc, pOption);
+			CbcSetCglOptions(hCbc, pSolver, pOption);
+			CbcAddUserCutGenerators(hCbc, pProblem, pSolver, pOption);
+			CbcAddUserHeuristic(hCbc, pSolver, pOption);
+			for (i = 0; i < pCbc->cbc->numberCutGenerators(); i++) {
+				pCbc->cbc->cutGenerator(i)->setTiming(true);
+			}
+			CbcStopPhase(pResult, COIN_PHASE_OPTIONS);
 
-			pCbc->cbc->initialSolve();
+			CbcInitialSolve(hCbc, pProblem, pResult, pOption);
+			pResult->Stats.RootLPObjValue = pCbc->cbc->solver()->getObjValue();
+			CbcStartPhase(pResult, COIN_PHASE_BRANCH);
 			pCbc->cbc->branchAndBound();
+			CbcStopPhase(pResult, COIN_PHASE_BRANCH);
+			CbcCollectCutGenStats(hCbc, pResult);
 		}
 	}
 	return CBC_CALL_SUCCESS;
 }
 
 
-int CbcRetrieveSolutionResults(HCBC hCbc, PPROBLEM pProblem, PRESULT pResult)
+/* Solver objects handed to a result as solution view are freed here when
+   the view is released */
+
+static void CbcReleaseSolutionView(void* SolverView)
+{
+	CbcClearSolverObject((HCBC)SolverView);
+}
+
+
+int CbcRetrieveSolutionResults(HCBC hCbc, PPROBLEM pProblem, PRESULT pResult, int SolutionView)
 {
 	PCBC pCbc = (PCBC)hCbc;
 	const double* columnPrimal;
 	const double* columnDual;
 	const double* rowPrimal;
 	const double* rowDual;
-	int i;
 
 	if (!pProblem->SolveAsMIP) {
 		pResult->SolutionStatus = pCbc->clp->status();
@@ -1004,35 +2051,41 @@ int CbcRetrieveSolutionResults(HCBC hCbc, PPROBLEM pProblem, PRESULT pResult)
 			break;
 	}
 
+	if (SolutionView) {
+		/* the result takes over the solver object and refers to its arrays */
+		if (!pProblem->SolveAsMIP) {
+			if (!coinSetSolutionView(pResult, hCbc, CbcReleaseSolutionView, pProblem->RowCount,
+						pCbc->clp->primalColumnSolution(), pCbc->clp->dualColumnSolution(),
+						pCbc->clp->primalRowSolution(), pCbc->clp->dualRowSolution())) {
+				return CBC_CALL_FAILED;
+			}
+			coinComputeRowSlack(pProblem, pResult->RowActivity, pResult->SlackValues);
+		}
+		else {
+			if (!coinSetSolutionView(pResult, hCbc, CbcReleaseSolutionView, pProblem->RowCount,
+						pCbc->cbc->solver()->getColSolution(), NULL, NULL, NULL)) {
+				return CBC_CALL_FAILED;
+			}
+		}
+		return CBC_CALL_SUCCESS;
+	}
 	if (!pProblem->SolveAsMIP) {
 		columnPrimal = pCbc->clp->primalColumnSolution();
 		columnDual = pCbc->clp->dualColumnSolution();
 		rowPrimal = pCbc->clp->primalRowSolution();
 		rowDual = pCbc->clp->dualRowSolution();
-		pResult->ColActivity = (double*) malloc(pProblem->ColCount * sizeof(double));
-		pResult->ReducedCost = (double*) malloc(pProblem->ColCount * sizeof(double));
-		pResult->RowActivity = (double*) malloc(pProblem->RowCount * sizeof(double));
-		pResult->SlackValues = (double*) malloc(pProblem->RowCount * sizeof(double));
-		pResult->ShadowPrice = (double*) malloc(pProblem->RowCount * sizeof(double));
-		if (!pResult->ColActivity ||
-			!pResult->ReducedCost ||
-			!pResult->RowActivity ||
-			!pResult->SlackValues ||
-			!pResult->ShadowPrice) {
+		if (!coinAllocSolutionArrays(pResult, pProblem->ColCount, pProblem->RowCount, 0)) {
 			return CBC_CALL_FAILED;
 		}
 		memcpy(pResult->ColActivity, columnPrimal, pProblem->ColCount * sizeof(double));
 		memcpy(pResult->ReducedCost, columnDual, pProblem->ColCount * sizeof(double));
 		memcpy(pResult->RowActivity, rowPrimal, pProblem->RowCount * sizeof(double));
 		memcpy(pResult->ShadowPrice, rowDual, pProblem->RowCount * sizeof(double));
-		for (i = 0; i < pProblem->RowCount; i++) {
-			pResult->SlackValues[i] = pProblem->RHSValues[i] - pResult->RowActivity[i];
-		}
+		coinComputeRowSlack(pProblem, pResult->RowActivity, pResult->SlackValues);
 		}
 	else {
 		columnPrimal = pCbc->cbc->solver()->getColSolution();
-		pResult->ColActivity = (double*) malloc(pProblem->ColCount * sizeof(double));
-		if (!pResult->ColActivity) {
+		if (!coinAllocSolutionArrays(pResult, pProblem->ColCount, pProblem->RowCount, 1)) {
 			return CBC_CALL_FAILED;
 		}
 		memcpy(pResult->ColActivity, columnPrimal, pProblem->ColCount * sizeof(double));
@@ -1042,31 +2095,225 @@ int CbcRetrieveSolutionResults(HCBC hCbc, PPROBLEM pProblem, PRESULT pResult)
 
 
 
+/* Two stage stochastic models are solved through a problem built from
+   the core model and its scenarios, either the deterministic equivalent
+   with a copy of the second stage for each scenario or the expected value
+   problem.  Building it counts as loading the problem. */
+
+static int CbcOptimizeScenarios(PPROBLEM pProblem, PRESULT pResult, PSOLVER pSolver, POPTION pOption, int Method)
+{
+	PPROBLEM pScen;
+	double wallTime, cpuTime;
+	int result;
+	int i;
+
+	wallTime = CoinGetTimeOfDay();
+	cpuTime = CoinCpuTime();
+	if (Method & SOLV_METHOD_DEQ) {
+		pScen = coinBuildDeterministicEq(pProblem);
+	}
+	else {
+		pScen = coinBuildExpectedValue(pProblem);
+	}
+	if (!pScen) {
+		return CBC_CALL_FAILED;
+	}
+	wallTime = CoinGetTimeOfDay() - wallTime;
+	cpuTime = CoinCpuTime() - cpuTime;
+	result = CbcOptimizeProblem(pScen, pResult, pSolver, pOption, Method & ~(SOLV_METHOD_DEQ | SOLV_METHOD_EV));
+	if ((result == CBC_CALL_SUCCESS) && (Method & SOLV_METHOD_DEQ)) {
+		/* pool solutions keep the core columns, which is scenario 0 */
+		if (pResult->PoolColValues && (pResult->PoolColCount > pProblem->ColCount)) {
+			for (i = 1; i < pResult->PoolCount; i++) {
+				memmove(&pResult->PoolColValues[(size_t)i * pProblem->ColCount],
+						&pResult->PoolColValues[(size_t)i * pResult->PoolColCount],
+						pProblem->ColCount * sizeof(double));
+			}
+			pResult->PoolColCount = pProblem->ColCount;
+		}
+		pResult->ScenarioCount = pProblem->ScenCount;
+	}
+	pResult->Stats.WallTime[COIN_PHASE_LOAD] += wallTime;
+	pResult->Stats.CpuTime[COIN_PHASE_LOAD] += cpuTime;
+	pResult->Stats.TotalWallTime += wallTime;
+	pResult->Stats.TotalCpuTime += cpuTime;
+	pResult->Stats.ProblemBytes += coinGetProblemBytes(pProblem);
+	coinClearProblemObject(pScen);
+	return result;
+}
+
+
 int CbcOptimizeProblem(PPROBLEM pProblem, PRESULT pResult, PSOLVER pSolver, POPTION pOption, int Method)
 {
 	HCBC hCbc;
 	int result;
+	int solutionView;
+
+	int phase;
 
+	pResult->ScenarioCount = 0;
+	if (Method & (SOLV_METHOD_DEQ | SOLV_METHOD_EV)) {
+		return CbcOptimizeScenarios(pProblem, pResult, pSolver, pOption, Method);
+	}
+	/* the branch and bound only re-solves with dual simplex */
+	if (pProblem->SolveAsMIP && (pProblem->QuadNZCount > 0)) {
+		return CBC_CALL_FAILED;
+	}
+	if (Method & SOLV_METHOD_BENDERS) {
+		return BendersOptimizeProblem(pProblem, pResult, pSolver, pOption);
+	}
+	coinResetSolveStats(pResult);
+	/* a solver kept for the view of the previous solve goes first */
+	coinReleaseSolutionView(pResult);
+	solutionView = coinGetIntOption(pOption, COIN_INT_SOLUTIONVIEW);
 	hCbc = CbcCreateSolverObject();
+	CbcStartPhase(pResult, COIN_PHASE_LOAD);
 	result = CbcLoadAllSolverObjects(hCbc, pProblem);
+	CbcStopPhase(pResult, COIN_PHASE_LOAD);
 	result = CbcSetAllCallbacks(hCbc, pSolver, pOption);
-	result = CbcSolveProblem(hCbc, pProblem, pOption, Method);
-	result = CbcRetrieveSolutionResults(hCbc, pProblem, pResult);
-	CbcClearSolverObject(hCbc);
+	result = CbcRegisterSolveStats(hCbc, pResult, pSolver);
+	result = CbcRegisterSolutionPool(hCbc, pProblem, pResult, pOption);
+	coinBeginProgress(pSolver, CoinGetTimeOfDay());
+	result = CbcSolveProblem(hCbc, pProblem, pResult, pSolver, pOption, Method);
+	coinEndProgress(pSolver, CoinGetTimeOfDay());
+	CbcNotifyFinalSolution(hCbc, pProblem, pSolver);
+	CbcStartPhase(pResult, COIN_PHASE_RESULTS);
+	CbcCollectSolutionPool(hCbc, pProblem, pResult, pOption);
+	result = CbcRetrieveSolutionResults(hCbc, pProblem, pResult, solutionView);
+	CbcStopPhase(pResult, COIN_PHASE_RESULTS);
+	if (!solutionView || (result != CBC_CALL_SUCCESS)) {
+		CbcClearSolverObject(hCbc);
+	}
+	CbcLogCutGenStats(pSolver, pResult);
+
+	/* totals cover this optimize call, the store phase is reported apart */
+	for (phase = COIN_PHASE_LOAD; phase < COIN_PHASE_COUNT; phase++) {
+		pResult->Stats.TotalWallTime += pResult->Stats.WallTime[phase];
+		pResult->Stats.TotalCpuTime += pResult->Stats.CpuTime[phase];
+	}
+	pResult->Stats.ProblemBytes = coinGetProblemBytes(pProblem);
+	pResult->Stats.ResultBytes = coinGetResultBytes(pResult, pProblem->ColCount, pProblem->RowCount);
 	return CBC_CALL_SUCCESS;
 }
 
 
+/* Converts the row bounds read by Clp back into the row type, right hand
+   side and range form that CoinLoadProblem takes */
+
+int CbcComputeRowTypes(ClpSimplex *clp, char* RowType, double* RHSValues, double* RangeValues)
+{
+	const double* rowLower = clp->getRowLower();
+	const double* rowUpper = clp->getRowUpper();
+	int rangeCount = 0;
+	int i;
+
+	for (i = 0; i < clp->getNumRows(); i++) {
+		RangeValues[i] = 0.0;
+		if ((rowLower[i] <= -COIN_DBL_MAX) && (rowUpper[i] >= COIN_DBL_MAX)) {
+			RowType[i] = 'N';
+			RHSValues[i] = 0.0;
+		}
+		else if (rowLower[i] <= -COIN_DBL_MAX) {
+			RowType[i] = 'L';
+			RHSValues[i] = rowUpper[i];
+		}
+		else if (rowUpper[i] >= COIN_DBL_MAX) {
+			RowType[i] = 'G';
+			RHSValues[i] = rowLower[i];
+		}
+		else if (rowLower[i] == rowUpper[i]) {
+			RowType[i] = 'E';
+			RHSValues[i] = rowLower[i];
+		}
+		else {
+			RowType[i] = 'R';
+			RHSValues[i] = rowUpper[i];
+			RangeValues[i] = rowUpper[i] - rowLower[i];
+			rangeCount++;
+		}
+	}
+	return rangeCount;
+}
+
+
 int CbcReadMpsFile(PPROBLEM pProblem, const char *ReadFilename)
 {
 	PCBC pCbc;
 	HCBC hCbc;
+	ClpSimplex *clp;
+	int colCount, rowCount, rangeCount;
+	int i, result;
+	char* rowType;
+	double* rhsValues;
+	double* rangeValues;
+	char* colType;
+	const char* integerInfo;
 
 	hCbc = CbcCreateSolverObject();
 	pCbc = (PCBC)hCbc;
-	pCbc->clp->readMps(ReadFilename, 1, 0);
+	clp = pCbc->clp;
+	if (clp->readMps(ReadFilename, true, false) != 0) {
+		CbcClearSolverObject(hCbc);
+		return CBC_CALL_FAILED;
+	}
+	colCount = clp->getNumCols();
+	rowCount = clp->getNumRows();
+	CoinPackedMatrix matrix(*clp->matrix());
+	matrix.removeGaps();
+
+	rowType = (char*)malloc(rowCount * sizeof(char));
+	rhsValues = (double*)malloc(rowCount * sizeof(double));
+	rangeValues = (double*)malloc(rowCount * sizeof(double));
+	if (!rowType || !rhsValues || !rangeValues) {
+		if (rowType) free(rowType);
+		if (rhsValues) free(rhsValues);
+		if (rangeValues) free(rangeValues);
+		CbcClearSolverObject(hCbc);
+		return CBC_CALL_FAILED;
+	}
+	rangeCount = CbcComputeRowTypes(clp, rowType, rhsValues, rangeValues);
+	result = coinStoreMatrix(pProblem, colCount, rowCount, matrix.getNumElements(), rangeCount,
+					(int)clp->optimizationDirection(), -clp->objectiveOffset(),
+					clp->objective(), clp->columnLower(), clp->columnUpper(),
+					rowType, rhsValues, rangeValues, const_cast<int*>(matrix.getVectorStarts()),
+					const_cast<int*>(matrix.getVectorLengths()), const_cast<int*>(matrix.getIndices()),
+					const_cast<double*>(matrix.getElements()));
+	free(rowType);
+	free(rhsValues);
+	free(rangeValues);
+
+	if (result && (clp->lengthNames() > 0)) {
+		std::vector<std::string> colNames(colCount);
+		std::vector<std::string> rowNames(rowCount);
+		std::vector<char*> colNamesList(colCount);
+		std::vector<char*> rowNamesList(rowCount);
+		for (i = 0; i < colCount; i++) {
+			colNames[i] = clp->getColumnName(i);
+			colNamesList[i] = const_cast<char*>(colNames[i].c_str());
+		}
+		for (i = 0; i < rowCount; i++) {
+			rowNames[i] = clp->getRowName(i);
+			rowNamesList[i] = const_cast<char*>(rowNames[i].c_str());
+		}
+		result = coinStoreNamesList(pProblem, colCount ? &colNamesList[0] : NULL,
+									rowCount ? &rowNamesList[0] : NULL, NULL);
+	}
+	integerInfo = clp->integerInformation();
+	if (result && integerInfo) {
+		colType = (char*)malloc(colCount * sizeof(char));
+		if (!colType) {
+			result = 0;
+			}
+		else {
+			for (i = 0; i < colCount; i++) {
+				colType[i] = integerInfo[i] ? 'I' : 'C';
+			}
+			result = coinStoreInteger(pProblem, colType);
+			free(colType);
+		}
+	}
 	CbcClearSolverObject(hCbc);
-	return CBC_CALL_SUCCESS;
+	return result ? CBC_CALL_SUCCESS : CBC_CALL_FAILED;
 }
 
 
@@ -1085,7 +2332,7 @@ int CbcWriteMpsFile(PPROBLEM pProblem, const char *WriteFilename)
 	else {
 		extension = "";
 	}
-	pCbc->osi->writeMps(WriteFilename, extension, pProblem->ObjectSense);
+	CbcGetOsiSolver(hCbc)->writeMps(WriteFilename, extension, pProblem->ObjectSense);
 	//result = CbcClearAllSolverObjects(hCbc);
 	CbcClearSolverObject(hCbc);
 	return CBC_CALL_SUCCESS;
@@ -1097,7 +2344,7 @@ int CbcWriteMpsFile(PPROBLEM pProblem, const char *WriteFilename)
 /*  Option Table                                                        */
 /************************************************************************/
 
-#define OPTIONCOUNT    68
+#define OPTIONCOUNT    80
 
 
 SOLVOPTINFO OptionTable[OPTIONCOUNT] = {
@@ -1198,7 +2445,37 @@ SOLVOPTINFO OptionTable[OPTIONCOUNT] = {
 	{"MipCutSimpleRounding",   "CutSimpRound", GRP_MIPCUTS,        0,        0,      0,       1,  OPT_ONOFF,  0,   COIN_INT_MIPCUT_SIMPROUND},
 	{"MipSimpleRoundFrequency","SimpRoundFreq",GRP_MIPCUTS,       -1,       -1,-MAXINT,  MAXINT,  OPT_INT,    0,   COIN_INT_MIPSIMPROUND_FREQ},
 
-	{"MipUseCbcMain",          "UseCbcMain",   GRP_MIPSTRAT,       1,        1,      0,       1,  OPT_ONOFF,  0,   COIN_INT_MIPUSECBCMAIN}
+	{"MipUseCbcMain",          "UseCbcMain",   GRP_MIPSTRAT,       1,        1,      0,       1,  OPT_ONOFF,  0,   COIN_INT_MIPUSECBCMAIN},
+
+	/* LP iteration callback, called every N iterations and at most once per T milliseconds (0 - no time limit) */
+	{"LPIterCallbackFreq",     "IterCBFreq",   GRP_LOGFILE,        1,        1,      1,  MAXINT,  OPT_INT,    0,   COIN_INT_LPITERCBFREQ},
+	{"LPIterCallbackMsec",     "IterCBMsec",   GRP_LOGFILE,        0,        0,      0,  MAXINT,  OPT_INT,    0,   COIN_INT_LPITERCBMSEC},
+
+	/* Number of LP bases kept for warm starts of structurally identical problems (0 - off),
+	   the cache is shared by all problems and each solve sets its size */
+	{"BasisCacheSize",         "BasisCache",   GRP_SIMPLEX,        0,        0,      0,   10000,  OPT_INT,    0,   COIN_INT_BASISCACHE},
+
+	/* Number of results kept for resubmissions of identical problems and options (0 - off),
+	   the cache is shared by all problems and each solve sets its size */
+	{"SolutionCacheSize",      "SolutionCache",GRP_OTHER,          0,        0,      0,   10000,  OPT_INT,    0,   COIN_INT_SOLUTIONCACHE},
+
+	/* Solution arrays refer to the solver object, which is kept until the next solve (0 - copy) */
+	{"SolutionView",           "SolView",      GRP_OTHER,          0,        0,      0,       1,  OPT_ONOFF,  0,   COIN_INT_SOLUTIONVIEW},
+
+	/* Number of best MIP solutions kept, and their largest relative gap to the best one (0 - off) */
+	{"SolutionPoolSize",       "SolPool",      GRP_MIPSTRAT,       0,        0,      0,    1000,  OPT_INT,    0,   COIN_INT_SOLUTIONPOOL},
+	{"SolutionPoolGap",        "SolPoolGap",   GRP_MIPSTRAT, MAXREAL,  MAXREAL,    0.0, MAXREAL,  OPT_REAL,   0,   COIN_REAL_SOLUTIONPOOLGAP},
+
+	/* User cut callback, same frequency values as the Cgl generators */
+	{"MipUserCutFrequency",    "UserCutFreq",  GRP_MIPCUTS,        1,        1,-MAXINT,  MAXINT,  OPT_INT,    0,   COIN_INT_MIPUSERCUT_FREQ},
+
+	/* User heuristic callback, called at most once every N nodes (0 - root only) */
+	{"MipUserHeurFrequency",   "UserHeurFreq", GRP_MIPSTRAT,       1,        1,      0,  MAXINT,  OPT_INT,    0,   COIN_INT_MIPUSERHEUR_FREQ},
+
+	/* Benders decomposition, threads for the subproblems (0 - one per processor), iteration limit and relative gap */
+	{"BendersThreads",         "BendThreads",  GRP_OTHER,          0,        0,      0,     256,  OPT_INT,    0,   COIN_INT_BENDERSTHREADS},
+	{"BendersMaxIterations",   "BendMaxIter",  GRP_LIMITS,      1000,     1000,      1,  MAXINT,  OPT_INT,    0,   COIN_INT_BENDERSMAXITER},
+	{"BendersGap",             "BendGap",      GRP_OTHER,       1e-6,     1e-6,    0.0,     1.0,  OPT_REAL,   0,   COIN_REAL_BENDERSGAP}
 	};
 
 int CbcGetOptionCount(void)
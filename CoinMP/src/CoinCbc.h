@@ -40,8 +40,16 @@ extern "C" {
 #define CBC_CALL_SUCCESS   0
 #define CBC_CALL_FAILED    -1
 
+void CbcInitSolver(void);
+void CbcFreeSolver(void);
+
 int CbcOptimizeProblem(PPROBLEM pProblem, PRESULT pResult, PSOLVER pSolver, POPTION pOption, int Method);
 
+void CbcStartPhase(PRESULT pResult, int Phase);
+void CbcStopPhase(PRESULT pResult, int Phase);
+
+void CbcFreeCutGenerators(PSOLVER pSolver);
+
 int CbcReadMpsFile(PPROBLEM pProblem, const char *ReadFilename);
 int CbcWriteMpsFile(PPROBLEM pProblem, const char *WriteFilename);
 
@@ -144,4 +152,21 @@ int CbcSetRealOption(int OptionID, double RealValue);
 
 #define COIN_INT_MIPUSECBCMAIN           200
 
+#define COIN_INT_LPITERCBFREQ            210
+#define COIN_INT_LPITERCBMSEC            211
+
+#define COIN_INT_BASISCACHE              212
+#define COIN_INT_SOLUTIONCACHE           213
+#define COIN_INT_SOLUTIONVIEW            214
+
+#define COIN_INT_SOLUTIONPOOL            215
+#define COIN_REAL_SOLUTIONPOOLGAP        216
+
+#define COIN_INT_MIPUSERCUT_FREQ         217
+#define COIN_INT_MIPUSERHEUR_FREQ        218
+
+#define COIN_INT_BENDERSTHREADS          219
+#define COIN_INT_BENDERSMAXITER          220
+#define COIN_REAL_BENDERSGAP             221
+
 #endif  /* _COINCBC_H_ */
@@ -24,8 +24,11 @@
 #include "CoinResult.h"
 #include "CoinSolver.h"
 #include "CoinOption.h"
+#include "CoinCache.h"
+#include "CoinScenario.h"
 
 #include "CoinCbc.h"
+#include "CoinTime.hpp"
 
 #include "config_coinmp_default.h"
 
@@ -47,14 +50,26 @@ const char* COINMP_NAME = "CoinMP";
 /************************************************************************/
 
 
+/* Results of earlier solves, keyed on a hash of the problem data, the
+   changed options and the solve method */
+static PCACHE SolutionCache = NULL;
+
+
 SOLVAPI int SOLVCALL CoinInitSolver(const char* LicenseStr)
 {
+	CbcInitSolver();
+	if (!SolutionCache) {
+		SolutionCache = coinCreateCache(0);
+	}
 	return SOLV_CALL_SUCCESS;
 }
 
 
 SOLVAPI int SOLVCALL CoinFreeSolver(void)
 {
+	CbcFreeSolver();
+	coinClearCache(SolutionCache);
+	SolutionCache = NULL;
 	return SOLV_CALL_SUCCESS;
 }
 
@@ -100,7 +115,9 @@ SOLVAPI double SOLVCALL CoinGetVersion(void)
 SOLVAPI int SOLVCALL CoinGetFeatures(void)
 {
 	return SOLV_FEATURE_LP |
-		   SOLV_FEATURE_MIP;
+		   SOLV_FEATURE_QP |
+		   SOLV_FEATURE_MIP |
+		   SOLV_FEATURE_SP;
 }
 
 
@@ -108,7 +125,10 @@ SOLVAPI int SOLVCALL CoinGetMethods(void)
 {
 	return SOLV_METHOD_PRIMAL |
 			SOLV_METHOD_DUAL | 
-			SOLV_METHOD_BARRIER;
+			SOLV_METHOD_BARRIER |
+			SOLV_METHOD_BENDERS |
+			SOLV_METHOD_DEQ |
+			SOLV_METHOD_EV;
 }
 
 
@@ -151,7 +171,7 @@ SOLVAPI HPROB SOLVCALL CoinCreateProblem(const char* ProblemName)
 	pCoin->pOption = coinCreateOptionObject();
 
 	coinSetProblemName(pCoin->pProblem, ProblemName);
-	coinCopyOptionTable(pCoin->pOption, CbcGetOptionTable(), CbcGetOptionCount());
+	coinSetOptionTable(pCoin->pOption, CbcGetOptionTable(), CbcGetOptionCount());
 
 	return (HPROB)pCoin;
 }
@@ -164,6 +184,7 @@ SOLVAPI int SOLVCALL CoinUnloadProblem(HPROB hProb)
 	if (pCoin) {
 		coinClearProblemObject(pCoin->pProblem);
 		coinClearResultObject(pCoin->pResult);
+		CbcFreeCutGenerators(pCoin->pSolver);
 		coinClearSolverObject(pCoin->pSolver);
 		coinClearOptionObject(pCoin->pOption);
 	}
@@ -174,6 +195,17 @@ SOLVAPI int SOLVCALL CoinUnloadProblem(HPROB hProb)
 
 
 
+/* The store phase covers copying the matrix into CoinMP, names and
+   other optional data are loaded separately and not included */
+
+static void CoinStartStorePhase(PRESULT pResult)
+{
+	pResult->Stats.WallTime[COIN_PHASE_STORE] = 0.0;
+	pResult->Stats.CpuTime[COIN_PHASE_STORE] = 0.0;
+	CbcStartPhase(pResult, COIN_PHASE_STORE);
+}
+
+
 SOLVAPI int SOLVCALL CoinLoadMatrix(HPROB hProb, 
 				int ColCount, int RowCount, int NZCount, int RangeCount, 
 				int ObjectSense, double ObjectConst, double* ObjectCoeffs, 
@@ -183,11 +215,15 @@ SOLVAPI int SOLVCALL CoinLoadMatrix(HPROB hProb,
 {
 	PCOIN pCoin = (PCOIN)hProb;
 	PPROBLEM pProblem = pCoin->pProblem;
+	int result;
 
-	if (!coinStoreMatrix(pProblem, ColCount, RowCount, NZCount, RangeCount, ObjectSense,
+	CoinStartStorePhase(pCoin->pResult);
+	result = coinStoreMatrix(pProblem, ColCount, RowCount, NZCount, RangeCount, ObjectSense,
 						 ObjectConst, ObjectCoeffs, LowerBounds, UpperBounds, RowType,
 						 RHSValues, RangeValues, MatrixBegin, MatrixCount, MatrixIndex,
-						 MatrixValues)) {
+						 MatrixValues);
+	CbcStopPhase(pCoin->pResult, COIN_PHASE_STORE);
+	if (!result) {
 		return SOLV_CALL_FAILED;
 	}
 	return SOLV_CALL_SUCCESS;
@@ -228,11 +264,15 @@ SOLVAPI int SOLVCALL CoinLoadProblem(HPROB hProb,
 {
 	PCOIN pCoin = (PCOIN)hProb;
 	PPROBLEM pProblem = pCoin->pProblem;
+	int result;
 
-	if (!coinStoreMatrix(pProblem, ColCount, RowCount, NZCount, RangeCount, ObjectSense,
+	CoinStartStorePhase(pCoin->pResult);
+	result = coinStoreMatrix(pProblem, ColCount, RowCount, NZCount, RangeCount, ObjectSense,
 						 ObjectConst, ObjectCoeffs, LowerBounds, UpperBounds, RowType,
 						 RHSValues, RangeValues, MatrixBegin, MatrixCount, MatrixIndex,
-						 MatrixValues)) {
+						 MatrixValues);
+	CbcStopPhase(pCoin->pResult, COIN_PHASE_STORE);
+	if (!result) {
 		return SOLV_CALL_FAILED;
 	}
 	if (!coinStoreNamesList(pProblem, ColNamesList, RowNamesList, ObjectName)) {
@@ -253,11 +293,15 @@ SOLVAPI int SOLVCALL CoinLoadProblemBuf(HPROB hProb,
 {
 	PCOIN pCoin = (PCOIN)hProb;
 	PPROBLEM pProblem = pCoin->pProblem;
+	int result;
 
-	if (!coinStoreMatrix(pProblem, ColCount, RowCount, NZCount, RangeCount, ObjectSense,
+	CoinStartStorePhase(pCoin->pResult);
+	result = coinStoreMatrix(pProblem, ColCount, RowCount, NZCount, RangeCount, ObjectSense,
 						 ObjectConst, ObjectCoeffs, LowerBounds, UpperBounds, RowType,
 						 RHSValues, RangeValues, MatrixBegin, MatrixCount, MatrixIndex,
-						 MatrixValues)) {
+						 MatrixValues);
+	CbcStopPhase(pCoin->pResult, COIN_PHASE_STORE);
+	if (!result) {
 		return SOLV_CALL_FAILED;
 	}
 	if (!coinStoreNamesBuf(pProblem, ColNamesBuf, RowNamesBuf, ObjectName)) {
@@ -334,7 +378,38 @@ SOLVAPI int SOLVCALL CoinLoadSemiCont(HPROB hProb, int SemiCount, int* SemiIndex
 SOLVAPI int SOLVCALL CoinLoadQuadratic(HPROB hProb, int* QuadBegin, int* QuadCount, 
 										int* QuadIndex, double* QuadValues)
 {
-	return SOLV_CALL_FAILED;
+	PCOIN pCoin = (PCOIN)hProb;
+
+	if (!coinStoreQuadratic(pCoin->pProblem, QuadBegin, QuadCount, QuadIndex, QuadValues)) {
+		return SOLV_CALL_FAILED;
+	}
+	return SOLV_CALL_SUCCESS;
+}
+
+
+SOLVAPI int SOLVCALL CoinLoadBlocks(HPROB hProb, int BlockCount, int* ColBlock, int* RowBlock)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	if (!coinStoreBlocks(pCoin->pProblem, BlockCount, ColBlock, RowBlock)) {
+		return SOLV_CALL_FAILED;
+	}
+	return SOLV_CALL_SUCCESS;
+}
+
+
+SOLVAPI int SOLVCALL CoinLoadScenarios(HPROB hProb, int ScenCount, double* ScenProb,
+										int* RhsBegin, int* RhsIndex, double* RhsValues,
+										int* ObjBegin, int* ObjIndex, double* ObjValues,
+										int* BoundBegin, int* BoundIndex, double* LowerValues, double* UpperValues)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	if (!coinStoreScenarios(pCoin->pProblem, ScenCount, ScenProb, RhsBegin, RhsIndex, RhsValues,
+				ObjBegin, ObjIndex, ObjValues, BoundBegin, BoundIndex, LowerValues, UpperValues)) {
+		return SOLV_CALL_FAILED;
+	}
+	return SOLV_CALL_SUCCESS;
 }
 
 
@@ -349,97 +424,28 @@ SOLVAPI int SOLVCALL CoinLoadNonlinear(HPROB hProb, int NlpTreeCount, int NlpLin
 
 
 
-#define CHECK_MAXNAMELEN   100
+SOLVAPI int SOLVCALL CoinCheckProblem(HPROB hProb)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+	CHECKINFO CheckInfo;
+
+	return coinCheckProblem(pCoin->pProblem, &CheckInfo);
+}
 
 
-SOLVAPI int SOLVCALL CoinCheckProblem(HPROB hProb)
+SOLVAPI int SOLVCALL CoinCheckProblemReport(HPROB hProb, COIN_CHECKREPORT* CheckReport)
 {
 	PCOIN pCoin = (PCOIN)hProb;
-	PPROBLEM pProblem = pCoin->pProblem;
-	int i;
+	CHECKINFO CheckInfo;
 
-	if (pProblem->ColCount == 0) {
-		return SOLV_CHECK_COLCOUNT;
-	}
-	if ((pProblem->RowCount < 0) ||
-		(pProblem->NZCount < 0) ||
-		(pProblem->RangeCount < 0)) {
-		return SOLV_CHECK_ROWCOUNT;
-	}
-	if ((pProblem->RangeCount > pProblem->RowCount)) {
-		return SOLV_CHECK_RANGECOUNT;
-	}
-	if ((pProblem->ObjectSense < -1) || 
-		(pProblem->ObjectSense > 1)) {
-		return SOLV_CHECK_OBJSENSE;
-	}
-	if (pProblem->RowType && (pProblem->RowCount > 0)) {
-		for (i = 0; i < pProblem->RowCount; i++) {
-			if ((pProblem->RowType[i] != 'L') &&
-				(pProblem->RowType[i] != 'E') &&
-				(pProblem->RowType[i] != 'G') &&
-				(pProblem->RowType[i] != 'R') &&
-				(pProblem->RowType[i] != 'N')) {
-				return SOLV_CHECK_ROWTYPE;
-			}
-		}
-	}
-	if (pProblem->NZCount > 0) {
-		for (i = 0; i < pProblem->ColCount; i++) {
-			if (pProblem->MatrixBegin[i] < 0) {
-				return SOLV_CHECK_MATBEGIN;
-			}
-			if (pProblem->MatrixCount[i] < 0) {
-				return SOLV_CHECK_MATCOUNT;
-			}
-			if (pProblem->MatrixBegin[i+1] - pProblem->MatrixBegin[i] != pProblem->MatrixCount[i]) {
-				return SOLV_CHECK_MATBEGCNT;
-			}
-		}
-		if (pProblem->MatrixBegin[pProblem->ColCount] != pProblem->NZCount) {
-			return 100 + pProblem->MatrixBegin[pProblem->ColCount];
-		}
-		for (i = 0; i < pProblem->NZCount; i++) {
-			if (pProblem->MatrixIndex[i] < 0) {
-				return SOLV_CHECK_MATINDEX;
-			}
-			if (pProblem->MatrixIndex[i] >= pProblem->RowCount) {
-				return SOLV_CHECK_MATINDEXROW;
-			}
-		}
-	}
-	if (pProblem->LowerBounds && pProblem->UpperBounds) {
-		for (i = 0; i < pProblem->ColCount; i++) {
-			if (pProblem->LowerBounds[i] > pProblem->UpperBounds[i]) {
-				return SOLV_CHECK_BOUNDS;
-			}
-		}
-	}
-	if (pProblem->ColType) {
-		for (i = 0; i < pProblem->ColCount; i++) {
-			if ((pProblem->ColType[i] != 'C') &&
-				(pProblem->ColType[i] != 'B') &&
-				(pProblem->ColType[i] != 'I')) {
-				return SOLV_CHECK_COLTYPE;
-			}
-		}
-	}
-	if (pProblem->ColNamesBuf) {
-		if (pProblem->lenColNamesBuf <= 0) {
-			return SOLV_CHECK_COLNAMES;
-		}
-		if (pProblem->lenColNamesBuf > pProblem->ColCount * CHECK_MAXNAMELEN) {
-			return SOLV_CHECK_COLNAMESLEN;
-		}
-	}
-	if (pProblem->RowNamesBuf) {
-		if (pProblem->lenRowNamesBuf <= 0) {
-			return SOLV_CHECK_ROWNAMES;
-		}
-		if (pProblem->lenRowNamesBuf > pProblem->RowCount * CHECK_MAXNAMELEN) {
-			return SOLV_CHECK_ROWNAMSLEN;
-		}
+	if (!CheckReport) {
+		return SOLV_CALL_FAILED;
 	}
+	coinCheckProblem(pCoin->pProblem, &CheckInfo);
+	CheckReport->ErrorCount = CheckInfo.ErrorCount;
+	CheckReport->FirstError = CheckInfo.FirstError;
+	memcpy(CheckReport->CheckCount, CheckInfo.CheckCount, sizeof(CheckReport->CheckCount));
+	memcpy(CheckReport->CheckIndex, CheckInfo.CheckIndex, sizeof(CheckReport->CheckIndex));
 	return SOLV_CALL_SUCCESS;
 }
 
@@ -545,6 +551,63 @@ SOLVAPI int SOLVCALL CoinRegisterMipNodeCallback(HPROB hProb, COIN_MIPNODE_CB Mi
 }
 
 
+SOLVAPI int SOLVCALL CoinRegisterMipSolutionCallback(HPROB hProb, COIN_MIPSOL_CB MipSolutionCB, void *UserParam)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	pCoin->pSolver->MipSolutionCB = MipSolutionCB;
+	pCoin->pSolver->MipSolutionParam = UserParam;
+	return SOLV_CALL_SUCCESS;
+}
+
+
+SOLVAPI int SOLVCALL CoinRegisterLazyConstraintCallback(HPROB hProb, COIN_LAZYCON_CB LazyConCB, void *UserParam)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	pCoin->pSolver->LazyConCB = LazyConCB;
+	pCoin->pSolver->LazyConParam = UserParam;
+	return SOLV_CALL_SUCCESS;
+}
+
+
+SOLVAPI int SOLVCALL CoinRegisterUserCutCallback(HPROB hProb, COIN_USERCUT_CB UserCutCB, void *UserParam)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	pCoin->pSolver->UserCutCB = UserCutCB;
+	pCoin->pSolver->UserCutParam = UserParam;
+	return SOLV_CALL_SUCCESS;
+}
+
+
+SOLVAPI int SOLVCALL CoinRegisterHeuristicCallback(HPROB hProb, COIN_HEURISTIC_CB HeuristicCB, void *UserParam)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	pCoin->pSolver->HeuristicCB = HeuristicCB;
+	pCoin->pSolver->HeuristicParam = UserParam;
+	return SOLV_CALL_SUCCESS;
+}
+
+
+/* Only valid inside a callback that was passed hCuts */
+
+SOLVAPI int SOLVCALL CoinAddCut(HCUTS hCuts, int NZCount, const int* ColIndex, const double* Values,
+								double RowLower, double RowUpper)
+{
+	PCUTBUF pCutBuf = (PCUTBUF)hCuts;
+
+	if (!pCutBuf) {
+		return SOLV_CALL_FAILED;
+	}
+	if (!coinAddCutRow(pCutBuf, NZCount, ColIndex, Values, RowLower, RowUpper)) {
+		return SOLV_CALL_FAILED;
+	}
+	return SOLV_CALL_SUCCESS;
+}
+
+
 // Depreciated, use CoinRegisterMsgLogCallback instead
 SOLVAPI int SOLVCALL CoinSetMsgLogCallback(HPROB hProb, MSGLOGCALLBACK MsgLogCallback)
 {
@@ -579,11 +642,75 @@ SOLVAPI int SOLVCALL CoinSetMipNodeCallback(HPROB hProb, MIPNODECALLBACK MipNode
 /************************************************************************/
 
 
+static void CoinGetSolutionKey(PCOIN pCoin, int Method, PCACHEKEY pKey)
+{
+	*pKey = pCoin->pProblem->ContentHash;
+	coinHashChangedOptions(pCoin->pOption, pKey);
+	coinFinishCacheKey(pKey, pCoin->pProblem->ColCount, pCoin->pProblem->RowCount,
+					   pCoin->pProblem->NZCount, Method);
+}
+
+
 SOLVAPI int SOLVCALL CoinOptimizeProblem(HPROB hProb, int Method)
 {		
 	PCOIN pCoin = (PCOIN)hProb;
+	PPROBLEM pProblem = pCoin->pProblem;
+	PRESULT pResult = pCoin->pResult;
+	CACHEKEY key;
+	void* data;
+	char* saveData;
+	int dataSize;
+	int cacheSize;
+	int result;
+
+	cacheSize = coinGetIntOption(pCoin->pOption, COIN_INT_SOLUTIONCACHE);
+	/* a cached result only holds the solution values, callbacks would not
+	   run and the solution pool would stay empty, the deterministic
+	   equivalent holds more than the core model keeps */
+	if (!SolutionCache || (cacheSize == 0) || (Method & SOLV_METHOD_DEQ) ||
+		coinHasCallbacks(pCoin->pSolver) ||
+		(coinGetIntOption(pCoin->pOption, COIN_INT_SOLUTIONPOOL) > 0)) {
+		return CbcOptimizeProblem(pProblem, pResult, pCoin->pSolver, pCoin->pOption, Method);
+	}
+	CoinGetSolutionKey(pCoin, Method, &key);
+	if (coinCacheFetch(SolutionCache, &key, &data, &dataSize)) {
+		coinResetSolveStats(pResult);
+		result = coinLoadResultData(pResult, pProblem->ColCount, pProblem->RowCount, (char*)data, dataSize);
+		free(data);
+		if (result) {
+			return SOLV_CALL_SUCCESS;
+		}
+	}
+	result = CbcOptimizeProblem(pProblem, pResult, pCoin->pSolver, pCoin->pOption, Method);
+	/* only final answers are kept, a solve stopped on a limit may finish
+	   differently next time */
+	if ((result == SOLV_CALL_SUCCESS) && (pResult->SolutionStatus >= 0) && (pResult->SolutionStatus <= 2)) {
+		if (coinSaveResultData(pResult, pProblem->ColCount, pProblem->RowCount, &saveData, &dataSize)) {
+			coinSetCacheSize(SolutionCache, cacheSize);
+			coinCacheStore(SolutionCache, &key, saveData, dataSize);
+			free(saveData);
+		}
+	}
+	return result;
+}
+
+
+SOLVAPI int SOLVCALL CoinSetSolutionCacheDir(const char* DirName)
+{
+	if (!SolutionCache || !coinSetCacheSpillDir(SolutionCache, DirName)) {
+		return SOLV_CALL_FAILED;
+	}
+	return SOLV_CALL_SUCCESS;
+}
+
 
-	return CbcOptimizeProblem(pCoin->pProblem, pCoin->pResult, pCoin->pSolver, pCoin->pOption, Method);
+SOLVAPI int SOLVCALL CoinGetSolutionCacheStats(int* EntryCount, int* HitCount, int* MissCount)
+{
+	if (!SolutionCache || !EntryCount || !HitCount || !MissCount) {
+		return SOLV_CALL_FAILED;
+	}
+	coinGetCacheCounts(SolutionCache, EntryCount, HitCount, MissCount);
+	return SOLV_CALL_SUCCESS;
 }
 
 
@@ -653,6 +780,83 @@ SOLVAPI int SOLVCALL CoinGetMipNodeCount(HPROB hProb)
 }
 
 
+SOLVAPI int SOLVCALL CoinGetSolveStats(HPROB hProb, COIN_SOLVESTATS* SolveStats)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+	PSTATS pStats = &pCoin->pResult->Stats;
+
+	if (!SolveStats) {
+		return SOLV_CALL_FAILED;
+	}
+	memcpy(SolveStats->WallTime, pStats->WallTime, COIN_PHASE_COUNT * sizeof(double));
+	memcpy(SolveStats->CpuTime, pStats->CpuTime, COIN_PHASE_COUNT * sizeof(double));
+	SolveStats->TotalWallTime = pStats->TotalWallTime;
+	SolveStats->TotalCpuTime = pStats->TotalCpuTime;
+	SolveStats->CutGenCount = pStats->CutGenCount;
+	memcpy(SolveStats->CutGenName, pStats->CutGenName, sizeof(pStats->CutGenName));
+	memcpy(SolveStats->CutGenTime, pStats->CutGenTime, sizeof(pStats->CutGenTime));
+	SolveStats->RootLPObjValue = pStats->RootLPObjValue;
+	SolveStats->RootCutObjValue = pStats->RootCutObjValue;
+	SolveStats->ProblemBytes = pStats->ProblemBytes;
+	SolveStats->ResultBytes = pStats->ResultBytes;
+	SolveStats->BendersIterCount = pStats->BendersIterCount;
+	return SOLV_CALL_SUCCESS;
+}
+
+
+SOLVAPI int SOLVCALL CoinGetCutGenCount(HPROB hProb)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	return pCoin->pResult->Stats.CutGenCount;
+}
+
+
+SOLVAPI int SOLVCALL CoinGetCutGenStats(HPROB hProb, int GenNr, COIN_CUTGENSTATS* CutGenStats)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+	PSTATS pStats = &pCoin->pResult->Stats;
+
+	if (!CutGenStats || (GenNr < 0) || (GenNr >= pStats->CutGenCount)) {
+		return SOLV_CALL_FAILED;
+	}
+	strcpy(CutGenStats->Name, pStats->CutGenName[GenNr]);
+	CutGenStats->CallCount = pStats->CutGenCalls[GenNr];
+	CutGenStats->CutCount = pStats->CutGenCuts[GenNr];
+	CutGenStats->KeptCount = pStats->CutGenKept[GenNr];
+	CutGenStats->ColCutCount = pStats->CutGenColCuts[GenNr];
+	CutGenStats->Time = pStats->CutGenTime[GenNr];
+	return SOLV_CALL_SUCCESS;
+}
+
+
+// May be called from any thread while CoinOptimizeProblem is running
+SOLVAPI int SOLVCALL CoinGetProgress(HPROB hProb, COIN_PROGRESS* Progress)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+	PROGRESSINFO snapshot;
+
+	if (!Progress) {
+		return SOLV_CALL_FAILED;
+	}
+	coinReadProgress(pCoin->pSolver, &snapshot);
+	Progress->IsRunning = snapshot.IsRunning;
+	Progress->IterCount = snapshot.IterCount;
+	Progress->NodeCount = snapshot.NodeCount;
+	Progress->ObjectValue = snapshot.ObjectValue;
+	Progress->BestBound = snapshot.BestBound;
+	Progress->BestInteger = snapshot.BestInteger;
+	if (snapshot.StartTime == 0.0)
+		Progress->ElapsedTime = 0.0;
+	else if (snapshot.IsRunning)
+		Progress->ElapsedTime = CoinGetTimeOfDay() - snapshot.StartTime;
+	else {
+		Progress->ElapsedTime = snapshot.EndTime - snapshot.StartTime;
+	}
+	return SOLV_CALL_SUCCESS;
+}
+
+
 
 /************************************************************************/
 /*  Solution retrieval                                                  */
@@ -682,6 +886,167 @@ SOLVAPI int SOLVCALL CoinGetSolutionValues(HPROB hProb, double* Activity, double
 }
 
 
+SOLVAPI int SOLVCALL CoinGetScenarioValues(HPROB hProb, int Scenario, double* Activity, 
+											double* ReducedCost, double* SlackValues, double* ShadowPrice)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+	PPROBLEM pProblem = pCoin->pProblem;
+	PRESULT pResult = pCoin->pResult;
+
+	if ((pResult->ScenarioCount == 0) || (pResult->ScenarioCount != pProblem->ScenCount) ||
+		(pProblem->BlockCount != 1) || (Scenario < 0) || (Scenario >= pResult->ScenarioCount)) {
+		return SOLV_CALL_FAILED;
+	}
+	if (Activity && pResult->ColActivity) {
+		coinCopyScenarioValues(pProblem, Scenario, 0, pResult->ColActivity, Activity);
+	}
+	if (ReducedCost && pResult->ReducedCost) {
+		coinCopyScenarioValues(pProblem, Scenario, 0, pResult->ReducedCost, ReducedCost);
+	}
+	if (SlackValues && pResult->SlackValues) {
+		coinCopyScenarioValues(pProblem, Scenario, 1, pResult->SlackValues, SlackValues);
+	}
+	if (ShadowPrice && pResult->ShadowPrice) {
+		coinCopyScenarioValues(pProblem, Scenario, 1, pResult->ShadowPrice, ShadowPrice);
+	}
+	return SOLV_CALL_SUCCESS;
+}
+
+
+
+/* Selective retrieval reads only the requested entries of the result
+   arrays, the dense arrays are never copied to the caller */
+
+static int coinGetIndexedValues(const double* Values, int ValueCount, int Count, 
+								const int* Index, double* Output)
+{
+	int i;
+
+	if (!Values || (Count < 0) || (Count > 0 && (!Index || !Output))) {
+		return SOLV_CALL_FAILED;
+	}
+	for (i = 0; i < Count; i++) {
+		if ((Index[i] < 0) || (Index[i] >= ValueCount)) {
+			return SOLV_CALL_FAILED;
+		}
+		Output[i] = Values[Index[i]];
+	}
+	return SOLV_CALL_SUCCESS;
+}
+
+
+/* Returns the number of values above the tolerance, only the first
+   MaxCount of them are stored, so MaxCount 0 just counts them */
+
+static int coinGetNonzeroValues(const double* Values, int ValueCount, double Tolerance,
+								int MaxCount, int* Index, double* Output)
+{
+	int i, count;
+
+	if (!Values || (MaxCount > 0 && (!Index || !Output))) {
+		return SOLV_CALL_FAILED;
+	}
+	count = 0;
+	for (i = 0; i < ValueCount; i++) {
+		if ((Values[i] > Tolerance) || (Values[i] < -Tolerance)) {
+			if (count < MaxCount) {
+				Index[count] = i;
+				Output[count] = Values[i];
+			}
+			count++;
+		}
+	}
+	return count;
+}
+
+
+SOLVAPI int SOLVCALL CoinGetColValues(HPROB hProb, int Count, const int* ColIndex, double* Activity)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	return coinGetIndexedValues(pCoin->pResult->ColActivity, pCoin->pProblem->ColCount,
+								Count, ColIndex, Activity);
+}
+
+
+SOLVAPI int SOLVCALL CoinGetNonzeroColValues(HPROB hProb, double Tolerance, int MaxCount, 
+											 int* ColIndex, double* Activity)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	return coinGetNonzeroValues(pCoin->pResult->ColActivity, pCoin->pProblem->ColCount,
+								Tolerance, MaxCount, ColIndex, Activity);
+}
+
+
+SOLVAPI int SOLVCALL CoinGetRowValues(HPROB hProb, int Count, const int* RowIndex, double* Activity)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	return coinGetIndexedValues(pCoin->pResult->RowActivity, pCoin->pProblem->RowCount,
+								Count, RowIndex, Activity);
+}
+
+
+SOLVAPI int SOLVCALL CoinGetNonzeroRowValues(HPROB hProb, double Tolerance, int MaxCount, 
+											 int* RowIndex, double* Activity)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	return coinGetNonzeroValues(pCoin->pResult->RowActivity, pCoin->pProblem->RowCount,
+								Tolerance, MaxCount, RowIndex, Activity);
+}
+
+
+
+SOLVAPI const double* SOLVCALL CoinGetSolutionPtr(HPROB hProb, int Which)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+	PRESULT pResult = pCoin->pResult;
+
+	switch (Which) {
+		case SOLV_VALUES_ACTIVITY:		return pResult->ColActivity;
+		case SOLV_VALUES_REDUCEDCOST:	return pResult->ReducedCost;
+		case SOLV_VALUES_ROWACTIVITY:	return pResult->RowActivity;
+		case SOLV_VALUES_SLACK:			return pResult->SlackValues;
+		case SOLV_VALUES_SHADOWPRICE:	return pResult->ShadowPrice;
+	}
+	return NULL;
+}
+
+
+
+SOLVAPI int SOLVCALL CoinGetSolutionCount(HPROB hProb)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+
+	return pCoin->pResult->PoolCount;
+}
+
+
+SOLVAPI int SOLVCALL CoinGetSolutionValuesN(HPROB hProb, int SolutionNr, double* Activity,
+											double* ObjectValue, double* FoundTime)
+{
+	PCOIN pCoin = (PCOIN)hProb;
+	PRESULT pResult = pCoin->pResult;
+
+	if ((SolutionNr < 0) || (SolutionNr >= pResult->PoolCount)) {
+		return SOLV_CALL_FAILED;
+	}
+	if (Activity) {
+		memcpy(Activity, &pResult->PoolColValues[(size_t)SolutionNr * pResult->PoolColCount],
+			   pResult->PoolColCount * sizeof(double));
+	}
+	if (ObjectValue) {
+		*ObjectValue = pResult->PoolObjValue[SolutionNr];
+	}
+	if (FoundTime) {
+		*FoundTime = pResult->PoolFoundTime[SolutionNr];
+	}
+	return SOLV_CALL_SUCCESS;
+}
+
+
 
 SOLVAPI int SOLVCALL CoinGetSolutionRanges(HPROB hProb, double* ObjLoRange, double* ObjUpRange,
 											 double* RhsLoRange, double* RhsUpRange)
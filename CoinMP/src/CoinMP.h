@@ -92,6 +92,12 @@
 #define SOLV_FILE_BINOUT   7
 #define SOLV_FILE_IIS      8
 
+#define SOLV_VALUES_ACTIVITY     0
+#define SOLV_VALUES_REDUCEDCOST  1
+#define SOLV_VALUES_ROWACTIVITY  2
+#define SOLV_VALUES_SLACK        3
+#define SOLV_VALUES_SHADOWPRICE  4
+
 #define SOLV_CHECK_COLCOUNT     1
 #define SOLV_CHECK_ROWCOUNT     2
 #define SOLV_CHECK_RANGECOUNT   3
@@ -109,9 +115,26 @@
 #define SOLV_CHECK_COLNAMESLEN 15
 #define SOLV_CHECK_ROWNAMES    16
 #define SOLV_CHECK_ROWNAMSLEN  17
+#define SOLV_CHECK_MATVALUE    18
+#define SOLV_CHECK_OBJCOEFF    19
+#define SOLV_CHECK_RHSVALUE    20
+#define SOLV_CHECK_COUNT       21
+
+#define COIN_PHASE_STORE      0
+#define COIN_PHASE_LOAD       1
+#define COIN_PHASE_OPTIONS    2
+#define COIN_PHASE_PRESOLVE   3
+#define COIN_PHASE_LPSOLVE    4
+#define COIN_PHASE_CUTGEN     5
+#define COIN_PHASE_BRANCH     6
+#define COIN_PHASE_RESULTS    7
+#define COIN_PHASE_COUNT      8
+
+#define COIN_MAX_CUTGEN      16
 
 
 typedef void *HPROB;
+typedef void *HCUTS;
 
 #ifdef __cplusplus
 extern "C" {
@@ -133,6 +156,38 @@ typedef int (SOLVCALL *COIN_MIPNODE_CB)(int    IterCount,
 					int    IsMipImproved, 
 					void*  UserParam);
 
+/* ColValues points into the solver and is only valid during the call */
+typedef int (SOLVCALL *COIN_MIPSOL_CB)(int    MipNodeCount,
+					double ObjectValue,
+					int    ColCount,
+					const double* ColValues,
+					void*  UserParam);
+
+/* Called with every integer solution found, violated rows are returned
+   with CoinAddCut and added as globally valid cuts */
+typedef int (SOLVCALL *COIN_LAZYCON_CB)(int    ColCount,
+					const double* ColValues,
+					double ObjectValue,
+					HCUTS  hCuts,
+					void*  UserParam);
+
+/* Called in the cut rounds with the fractional LP solution, cuts valid for
+   the whole model are returned with CoinAddCut */
+typedef int (SOLVCALL *COIN_USERCUT_CB)(int    ColCount,
+					const double* ColValues,
+					double ObjectValue,
+					int    NodeDepth,
+					HCUTS  hCuts,
+					void*  UserParam);
+
+/* Called with the LP solution of a node, returns nonzero after filling
+   NewColValues with a candidate solution for Cbc to check */
+typedef int (SOLVCALL *COIN_HEURISTIC_CB)(int    MipNodeCount,
+					int    ColCount,
+					const double* ColValues,
+					double* NewColValues,
+					void*  UserParam);
+
 
 /* Depreciated, use COIN_XXX_CB instead */
 typedef int (SOLVCALL * MSGLOGCALLBACK)(const char* MessageStr);
@@ -149,6 +204,55 @@ typedef int (SOLVCALL *MIPNODECALLBACK)(int    IterCount,
 							   int    IsMipImproved);
 
 
+/* Timing of the last solve in seconds, indexed by COIN_PHASE_XXX */
+typedef struct {
+	double WallTime[COIN_PHASE_COUNT];
+	double CpuTime[COIN_PHASE_COUNT];
+	double TotalWallTime;
+	double TotalCpuTime;
+	int    CutGenCount;
+	char   CutGenName[COIN_MAX_CUTGEN][32];
+	double CutGenTime[COIN_MAX_CUTGEN];
+	double RootLPObjValue;
+	double RootCutObjValue;
+	double ProblemBytes;
+	double ResultBytes;
+	int    BendersIterCount;
+} COIN_SOLVESTATS;
+
+
+/* Result of CoinCheckProblemReport, CheckCount and CheckIndex give the
+   number of errors and the first offending row, column or nonzero for
+   each SOLV_CHECK_XXX code, the index is -1 if there is none */
+typedef struct {
+	int ErrorCount;
+	int FirstError;
+	int CheckCount[SOLV_CHECK_COUNT];
+	int CheckIndex[SOLV_CHECK_COUNT];
+} COIN_CHECKREPORT;
+
+/* Work done by one cut generator in the last MIP solve */
+typedef struct {
+	char   Name[32];
+	int    CallCount;
+	int    CutCount;
+	int    KeptCount;
+	int    ColCutCount;
+	double Time;
+} COIN_CUTGENSTATS;
+
+/* Snapshot of a running solve, safe to read from another thread */
+typedef struct {
+	int    IsRunning;
+	int    IterCount;
+	int    NodeCount;
+	double ObjectValue;
+	double BestBound;
+	double BestInteger;
+	double ElapsedTime;
+} COIN_PROGRESS;
+
+
 
 #ifdef SOLV_LINK_LIB
 
@@ -202,6 +306,8 @@ SOLVAPI int    SOLVCALL CoinLoadInitValues(HPROB hProb, double* InitValues);
 SOLVAPI int    SOLVCALL CoinLoadInteger(HPROB hProb, const char* ColumnType);
 
 
+/* PriorBranch is the preferred branch of each column, above zero for up,
+   below zero for down and zero to let the solver decide */
 SOLVAPI int    SOLVCALL CoinLoadPriority(HPROB hProb, int PriorCount, int* PriorIndex, 
 										  int* PriorValues, int* PriorBranch);
 
@@ -211,9 +317,28 @@ SOLVAPI int    SOLVCALL CoinLoadSos(HPROB hProb, int SosCount, int SosNZCount,
 
 SOLVAPI int    SOLVCALL CoinLoadSemiCont(HPROB hProb, int SemiCount, int* SemiIndex);
 
+/* Objective c'x + 0.5 x'Qx, Q column wise with one triangle of the
+   symmetric matrix, convex problems without integer columns only */
 SOLVAPI int    SOLVCALL CoinLoadQuadratic(HPROB hProb, int* QuadBegin, int* QuadCount, 
 								 int* QuadIndex, double* QuadValues);
 
+/* Block structure for SOLV_METHOD_BENDERS, ColBlock and RowBlock give 0
+   for the first stage columns and rows and 1 to BlockCount for the columns
+   and rows of each second stage subproblem.  The decomposition does not
+   call the MIP solution, lazy constraint, user cut or heuristic callbacks,
+   a solve with any of them registered fails. */
+SOLVAPI int    SOLVCALL CoinLoadBlocks(HPROB hProb, int BlockCount, int* ColBlock, int* RowBlock);
+
+/* Scenarios of a two stage stochastic model for SOLV_METHOD_DEQ and
+   SOLV_METHOD_EV, the second stage is block 1 of CoinLoadBlocks.  Scenario
+   s replaces the right hand side, objective and bounds listed from Begin[s]
+   to Begin[s+1], each Begin array may be NULL.  Without ScenProb the
+   scenarios are equally likely. */
+SOLVAPI int    SOLVCALL CoinLoadScenarios(HPROB hProb, int ScenCount, double* ScenProb,
+								 int* RhsBegin, int* RhsIndex, double* RhsValues,
+								 int* ObjBegin, int* ObjIndex, double* ObjValues,
+								 int* BoundBegin, int* BoundIndex, double* LowerValues, double* UpperValues);
+
 SOLVAPI int    SOLVCALL CoinLoadNonlinear(HPROB hProb, int NlpTreeCount, int NlpLineCount, 
 								 int* NlpBegin, int* NlpOper, int* NlpArg1, 
 								 int* NlpArg2, int* NlpIndex1, int* NlpIndex2, 
@@ -222,6 +347,7 @@ SOLVAPI int    SOLVCALL CoinLoadNonlinear(HPROB hProb, int NlpTreeCount, int Nlp
 SOLVAPI int    SOLVCALL CoinUnloadProblem(HPROB hProb);
 
 SOLVAPI int    SOLVCALL CoinCheckProblem(HPROB hProb);
+SOLVAPI int    SOLVCALL CoinCheckProblemReport(HPROB hProb, COIN_CHECKREPORT* CheckReport);
 
 /* Depreciated, use CoinLoadNamesBuf instead
 //SOLVAPI int    SOLVCALL CoinSetLoadNamesType(HPROB hProb, int LoadNamesType);
@@ -242,6 +368,13 @@ SOLVAPI int    SOLVCALL CoinGetRowNameBuf(HPROB hProb, int row, char* RowName, i
 SOLVAPI int SOLVCALL CoinRegisterMsgLogCallback(HPROB hProb, COIN_MSGLOG_CB MsgLogCB, void* UserParam);
 SOLVAPI int SOLVCALL CoinRegisterLPIterCallback(HPROB hProb, COIN_LPITER_CB LPIterCB, void* UserParam);
 SOLVAPI int SOLVCALL CoinRegisterMipNodeCallback(HPROB hProb, COIN_MIPNODE_CB MipNodeCB, void* UserParam);
+SOLVAPI int SOLVCALL CoinRegisterMipSolutionCallback(HPROB hProb, COIN_MIPSOL_CB MipSolutionCB, void* UserParam);
+SOLVAPI int SOLVCALL CoinRegisterLazyConstraintCallback(HPROB hProb, COIN_LAZYCON_CB LazyConCB, void* UserParam);
+SOLVAPI int SOLVCALL CoinRegisterUserCutCallback(HPROB hProb, COIN_USERCUT_CB UserCutCB, void* UserParam);
+SOLVAPI int SOLVCALL CoinRegisterHeuristicCallback(HPROB hProb, COIN_HEURISTIC_CB HeuristicCB, void* UserParam);
+
+SOLVAPI int SOLVCALL CoinAddCut(HCUTS hCuts, int NZCount, const int* ColIndex, const double* Values,
+					double RowLower, double RowUpper);
 
 /* Depreciated, use CoinRegisterXxxCallback instead */
 SOLVAPI int    SOLVCALL CoinSetMsgLogCallback(HPROB hProb, MSGLOGCALLBACK MsgLogCallback);
@@ -250,6 +383,11 @@ SOLVAPI int    SOLVCALL CoinSetMipNodeCallback(HPROB hProb, MIPNODECALLBACK MipN
 
 SOLVAPI int    SOLVCALL CoinOptimizeProblem(HPROB hProb, int Method);
 
+/* Results kept with the SolutionCacheSize option hold the solution values
+   only, problems with callbacks or a solution pool are always solved */
+SOLVAPI int    SOLVCALL CoinSetSolutionCacheDir(const char* DirName);
+SOLVAPI int    SOLVCALL CoinGetSolutionCacheStats(int* EntryCount, int* HitCount, int* MissCount);
+
 SOLVAPI int    SOLVCALL CoinGetSolutionStatus(HPROB hProb);
 SOLVAPI const char*  SOLVCALL CoinGetSolutionText(HPROB hProb);
 SOLVAPI int    SOLVCALL CoinGetSolutionTextBuf(HPROB hProb, char* SolutionText, int buflen);
@@ -260,8 +398,43 @@ SOLVAPI double SOLVCALL CoinGetMipBestBound(HPROB hProb);
 SOLVAPI int    SOLVCALL CoinGetIterCount(HPROB hProb);
 SOLVAPI int    SOLVCALL CoinGetMipNodeCount(HPROB hProb);
 
+SOLVAPI int    SOLVCALL CoinGetSolveStats(HPROB hProb, COIN_SOLVESTATS* SolveStats);
+SOLVAPI int    SOLVCALL CoinGetCutGenCount(HPROB hProb);
+SOLVAPI int    SOLVCALL CoinGetCutGenStats(HPROB hProb, int GenNr, COIN_CUTGENSTATS* CutGenStats);
+SOLVAPI int    SOLVCALL CoinGetProgress(HPROB hProb, COIN_PROGRESS* Progress);
+
 SOLVAPI int    SOLVCALL CoinGetSolutionValues(HPROB hProb, double* Activity, double* ReducedCost, 
 									 double* SlackValues, double* ShadowPrice);
+
+/* Solution of one scenario after SOLV_METHOD_DEQ, in the layout of the core
+   model.  CoinGetSolutionValues returns scenario 0.  The reduced costs and
+   shadow prices of the second stage include the scenario probability. */
+SOLVAPI int    SOLVCALL CoinGetScenarioValues(HPROB hProb, int Scenario, double* Activity, 
+									 double* ReducedCost, double* SlackValues, double* ShadowPrice);
+
+/* Activity of the listed columns or rows only, the Nonzero versions return
+   the number of entries above Tolerance and store up to MaxCount of them.
+   Row activities are only kept for LP solves. */
+SOLVAPI int    SOLVCALL CoinGetColValues(HPROB hProb, int Count, const int* ColIndex, double* Activity);
+SOLVAPI int    SOLVCALL CoinGetNonzeroColValues(HPROB hProb, double Tolerance, int MaxCount, 
+									 int* ColIndex, double* Activity);
+SOLVAPI int    SOLVCALL CoinGetRowValues(HPROB hProb, int Count, const int* RowIndex, double* Activity);
+SOLVAPI int    SOLVCALL CoinGetNonzeroRowValues(HPROB hProb, double Tolerance, int MaxCount, 
+									 int* RowIndex, double* Activity);
+
+/* Solution array selected by SOLV_VALUES_XXX without a copy, or NULL if
+   the last solve did not return it.  The array belongs to the problem and
+   stays valid until the next solve or CoinUnloadProblem.  With the option
+   SolutionView the arrays of the solver itself are returned. */
+SOLVAPI const double* SOLVCALL CoinGetSolutionPtr(HPROB hProb, int Which);
+
+/* Solutions kept in the MIP solution pool when SolutionPoolSize is set,
+   number 0 is the best one.  FoundTime is in seconds from the start of
+   the solve. */
+SOLVAPI int    SOLVCALL CoinGetSolutionCount(HPROB hProb);
+SOLVAPI int    SOLVCALL CoinGetSolutionValuesN(HPROB hProb, int SolutionNr, double* Activity,
+									 double* ObjectValue, double* FoundTime);
+
 SOLVAPI int    SOLVCALL CoinGetSolutionRanges(HPROB hProb, double* ObjLoRange, double* ObjUpRange,
 									 double* RhsLoRange, double* RhsUpRange);
 SOLVAPI int    SOLVCALL CoinGetSolutionBasis(HPROB hProb, int* ColStatus, int* RowStatus);
@@ -381,6 +554,12 @@ int    (SOLVCALL *CoinLoadSemiCont)(HPROB hProb, int SemiCount, int* SemiIndex);
 int    (SOLVCALL *CoinLoadQuadratic)(HPROB hProb, int* QuadBegin, int* QuadCount, 
 												 int* QuadIndex, double* QuadValues);
 
+int    (SOLVCALL *CoinLoadBlocks)(HPROB hProb, int BlockCount, int* ColBlock, int* RowBlock);
+int    (SOLVCALL *CoinLoadScenarios)(HPROB hProb, int ScenCount, double* ScenProb,
+									 int* RhsBegin, int* RhsIndex, double* RhsValues,
+									 int* ObjBegin, int* ObjIndex, double* ObjValues,
+									 int* BoundBegin, int* BoundIndex, double* LowerValues, double* UpperValues);
+
 int    (SOLVCALL *CoinLoadNonlinear)(HPROB hProb, int NlpTreeCount, int NlpLineCount, 
 												 int* NlpBegin, int* NlpOper, int* NlpArg1, 
 												 int* NlpArg2, int* NlpIndex1, int* NlpIndex2, 
@@ -389,6 +568,7 @@ int    (SOLVCALL *CoinLoadNonlinear)(HPROB hProb, int NlpTreeCount, int NlpLineC
 int    (SOLVCALL *CoinUnloadProblem)(HPROB hProb);
 
 int    (SOLVCALL *CoinCheckProblem)(HPROB hProb);
+int    (SOLVCALL *CoinCheckProblemReport)(HPROB hProb, COIN_CHECKREPORT* CheckReport);
 
 /* int    (SOLVCALL *CoinSetLoadNamesType)(HPROB hProb, int LoadNamesType); */
 
@@ -406,6 +586,13 @@ int    (SOLVCALL *CoinGetRowNameBuf)(HPROB hProb, int row, char* RowName, int bu
 int    (SOLVCALL *CoinRegisterMsgLogCallback)(HPROB hProb, COIN_MSGLOG_CB MsgLogCB, void* UserParam);
 int    (SOLVCALL *CoinRegisterLPIterCallback)(HPROB hProb, COIN_LPITER_CB LPIterCB, void* UserParam);
 int    (SOLVCALL *CoinRegisterMipNodeCallback)(HPROB hProb, COIN_MIPNODE_CB MipNodeCB, void* UserParam);
+int    (SOLVCALL *CoinRegisterMipSolutionCallback)(HPROB hProb, COIN_MIPSOL_CB MipSolutionCB, void* UserParam);
+int    (SOLVCALL *CoinRegisterLazyConstraintCallback)(HPROB hProb, COIN_LAZYCON_CB LazyConCB, void* UserParam);
+int    (SOLVCALL *CoinRegisterUserCutCallback)(HPROB hProb, COIN_USERCUT_CB UserCutCB, void* UserParam);
+int    (SOLVCALL *CoinRegisterHeuristicCallback)(HPROB hProb, COIN_HEURISTIC_CB HeuristicCB, void* UserParam);
+
+int    (SOLVCALL *CoinAddCut)(HCUTS hCuts, int NZCount, const int* ColIndex, const double* Values,
+					double RowLower, double RowUpper);
 
 /* Depreciated, use CoinRegisterXxxCallback instead */
 int    (SOLVCALL *CoinSetMsgLogCallback)(HPROB hProb, MSGLOGCALLBACK MsgLogCallback);
@@ -414,6 +601,9 @@ int    (SOLVCALL *CoinSetMipNodeCallback)(HPROB hProb, MIPNODECALLBACK MipNodeCa
 
 int    (SOLVCALL *CoinOptimizeProblem)(HPROB hProb, int Method);
 
+int    (SOLVCALL *CoinSetSolutionCacheDir)(const char* DirName);
+int    (SOLVCALL *CoinGetSolutionCacheStats)(int* EntryCount, int* HitCount, int* MissCount);
+
 int    (SOLVCALL *CoinGetSolutionStatus)(HPROB hProb);
 const char* (SOLVCALL *CoinGetSolutionText)(HPROB hProb);
 int    (SOLVCALL *CoinGetSolutionTextBuf)(HPROB hProb, char* SolutionText, int buflen);
@@ -424,8 +614,25 @@ double (SOLVCALL *CoinGetMipBestBound)(HPROB hProb);
 int    (SOLVCALL *CoinGetIterCount)(HPROB hProb);
 int    (SOLVCALL *CoinGetMipNodeCount)(HPROB hProb);
 
+int    (SOLVCALL *CoinGetSolveStats)(HPROB hProb, COIN_SOLVESTATS* SolveStats);
+int    (SOLVCALL *CoinGetCutGenCount)(HPROB hProb);
+int    (SOLVCALL *CoinGetCutGenStats)(HPROB hProb, int GenNr, COIN_CUTGENSTATS* CutGenStats);
+int    (SOLVCALL *CoinGetProgress)(HPROB hProb, COIN_PROGRESS* Progress);
+
 int    (SOLVCALL *CoinGetSolutionValues)(HPROB hProb, double* Activity, double* ReducedCost, 
 													  double* SlackValues, double* ShadowPrice);
+int    (SOLVCALL *CoinGetScenarioValues)(HPROB hProb, int Scenario, double* Activity, 
+													  double* ReducedCost, double* SlackValues, double* ShadowPrice);
+int    (SOLVCALL *CoinGetColValues)(HPROB hProb, int Count, const int* ColIndex, double* Activity);
+int    (SOLVCALL *CoinGetNonzeroColValues)(HPROB hProb, double Tolerance, int MaxCount, 
+										           int* ColIndex, double* Activity);
+int    (SOLVCALL *CoinGetRowValues)(HPROB hProb, int Count, const int* RowIndex, double* Activity);
+int    (SOLVCALL *CoinGetNonzeroRowValues)(HPROB hProb, double Tolerance, int MaxCount, 
+										           int* RowIndex, double* Activity);
+const double* (SOLVCALL *CoinGetSolutionPtr)(HPROB hProb, int Which);
+int    (SOLVCALL *CoinGetSolutionCount)(HPROB hProb);
+int    (SOLVCALL *CoinGetSolutionValuesN)(HPROB hProb, int SolutionNr, double* Activity,
+										           double* ObjectValue, double* FoundTime);
 int    (SOLVCALL *CoinGetSolutionRanges)(HPROB hProb, double* ObjLoRange, double* ObjUpRange,
 										           double* RhsLoRange, double* RhsUpRange);
 int    (SOLVCALL *CoinGetSolutionBasis)(HPROB hProb, int* ColStatus, int* RowStatus);
@@ -568,5 +775,24 @@ int    (SOLVCALL *CoinSetStringOption)(HPROB hProb, int OptionID, const char* St
 
 #define COIN_INT_MIPUSECBCMAIN           200   
 
+#define COIN_INT_LPITERCBFREQ            210
+#define COIN_INT_LPITERCBMSEC            211
+
+/* The basis and solution caches are shared by all problems, each solve
+   resizes them to its own BasisCacheSize and SolutionCacheSize */
+#define COIN_INT_BASISCACHE              212
+#define COIN_INT_SOLUTIONCACHE           213
+#define COIN_INT_SOLUTIONVIEW            214
+
+#define COIN_INT_SOLUTIONPOOL            215
+#define COIN_REAL_SOLUTIONPOOLGAP        216
+
+#define COIN_INT_MIPUSERCUT_FREQ         217
+#define COIN_INT_MIPUSERHEUR_FREQ        218
+
+#define COIN_INT_BENDERSTHREADS          219
+#define COIN_INT_BENDERSMAXITER          220
+#define COIN_REAL_BENDERSGAP             221
+
 
 #endif  /* _COINMP_H_ */
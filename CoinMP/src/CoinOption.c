@@ -24,6 +24,7 @@ POPTION coinCreateOptionObject()
 	pOption->OptionCount = 0;
 	pOption->OptionCopy = 0;
 	pOption->OptionTable = NULL;
+	pOption->ChangeCount = 0;
 
 	return pOption;
 }
@@ -43,18 +44,27 @@ void coinClearOptionObject(POPTION pOption)
 
 void coinCopyOptionTable(POPTION pOption, OPTIONTABLE OptionTable, int OptionCount)
 {
+	PSOLVOPT CopyTable;
+
 	if (!pOption) {
 		return;
 	}
 	if (OptionCount > 0) {
+		CopyTable = (PSOLVOPT)malloc(OptionCount * sizeof(SOLVOPTINFO));
+		if (!CopyTable) {
+			return;
+		}
+		memcpy(CopyTable, OptionTable, OptionCount * sizeof(SOLVOPTINFO));
 		pOption->OptionCount = OptionCount;
-		pOption->OptionTable = (PSOLVOPT)malloc(OptionCount * sizeof(SOLVOPTINFO));
-		memcpy(pOption->OptionTable, OptionTable, OptionCount * sizeof(SOLVOPTINFO));
+		pOption->OptionTable = CopyTable;
 		pOption->OptionCopy = 1;
 	}
 }
 
 
+/* Shares the table without copying it, the table is copied on the first
+   change to an option so problems that keep the defaults never copy it */
+
 void coinSetOptionTable(POPTION pOption, OPTIONTABLE OptionTable, int OptionCount)
 {
 	if (!pOption) {
@@ -65,6 +75,15 @@ void coinSetOptionTable(POPTION pOption, OPTIONTABLE OptionTable, int OptionCoun
 }
 
 
+static int coinOwnOptionTable(POPTION pOption)
+{
+	if (!pOption->OptionCopy) {
+		coinCopyOptionTable(pOption, pOption->OptionTable, pOption->OptionCount);
+	}
+	return pOption->OptionCopy;
+}
+
+
 int coinGetOptionCount(POPTION pOption)
 {
 	if (pOption == NULL) {
@@ -286,6 +305,31 @@ int coinGetOptionChanged(POPTION pOption, int OptionID)
 }
 
 
+/* Increases on every option set, lets the solver tell whether objects
+   configured from the options are still current */
+
+int coinGetOptionChangeCount(POPTION pOption)
+{
+	return pOption->ChangeCount;
+}
+
+
+/* Adds the options that differ from their defaults to a cache key, options
+   left at their defaults do not change the key */
+
+void coinHashChangedOptions(POPTION pOption, PCACHEKEY pKey)
+{
+	int i;
+
+	for (i = 0; i < pOption->OptionCount; i++) {
+		if (pOption->OptionTable[i].changed) {
+			coinHashCacheKey(pKey, &pOption->OptionTable[i].OptionID, sizeof(int));
+			coinHashCacheKey(pKey, &pOption->OptionTable[i].CurrentValue, sizeof(OPTVAL));
+		}
+	}
+}
+
+
 int coinGetIntOption(POPTION pOption, int OptionID)
 {
 	int OptionNr;
@@ -305,8 +349,12 @@ int coinSetIntOption(POPTION pOption, int OptionID, int IntValue)
 	if (OptionNr == -1) {
 		return -1;
 	}
+	if (!coinOwnOptionTable(pOption)) {
+		return -1;
+	}
 	pOption->OptionTable[OptionNr].CurrentValue = IntValue;
 	pOption->OptionTable[OptionNr].changed = 1;
+	pOption->ChangeCount++;
 	return 0;
 }
 
@@ -331,7 +379,11 @@ int coinSetRealOption(POPTION pOption, int OptionID, double RealValue)
 	if (OptionNr == -1) {
 		return -1;
 	}
+	if (!coinOwnOptionTable(pOption)) {
+		return -1;
+	}
 	pOption->OptionTable[OptionNr].CurrentValue = RealValue;
 	pOption->OptionTable[OptionNr].changed = 1;
+	pOption->ChangeCount++;
 	return 0;
 }
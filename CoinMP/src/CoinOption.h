@@ -5,6 +5,8 @@
 #ifndef _COINOPTION_H_
 #define _COINOPTION_H_
 
+#include "CoinCache.h"
+
 
 #if defined(_MSC_VER) && !defined(HAVE_CONFIG_H)
 #define SOLVCALL   __stdcall
@@ -67,6 +69,7 @@ typedef struct {
 				int OptionCount;
 				int OptionCopy;
 				OPTIONTABLE OptionTable;
+				int ChangeCount;
 
 				} OPTIONINFO, *POPTION;
 
@@ -105,6 +108,8 @@ double  coinGetRealOptionMinValue(POPTION pOption, int OptionID);
 double  coinGetRealOptionMaxValue(POPTION pOption, int OptionID);
 
 int     coinGetOptionChanged(POPTION pOption, int OptionID);
+int     coinGetOptionChangeCount(POPTION pOption);
+void    coinHashChangedOptions(POPTION pOption, PCACHEKEY pKey);
 
 int     coinGetIntOption(POPTION pOption, int OptionID);
 int     coinSetIntOption(POPTION pOption, int OptionID, int IntValue);
@@ -8,6 +8,35 @@
 
 #include "CoinProblem.h"
 
+/* Vector width of the problem checks.  AVX2 is chosen at run time, so
+   a build for the generic x86 target still uses it on processors that
+   have it.  NEON is part of every AArch64 processor.  Elsewhere the
+   plain loops are used. */
+#if (defined(__x86_64__) || defined(__i386__)) && \
+	(defined(__clang__) || (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+#define COIN_CHECK_AVX2
+#define CHECK_AVX2_TARGET  __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif (defined(_M_X64) || defined(_M_IX86)) && defined(_MSC_VER) && (_MSC_VER >= 1800)
+#define COIN_CHECK_AVX2
+#define CHECK_AVX2_TARGET
+#include <immintrin.h>
+#include <intrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define COIN_CHECK_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(COIN_CHECK_AVX2)
+#define CHECK_INTWIDTH    8
+#define CHECK_DBLWIDTH    4
+#define CHECK_CHARWIDTH  32
+#elif defined(COIN_CHECK_NEON)
+#define CHECK_INTWIDTH    4
+#define CHECK_DBLWIDTH    2
+#define CHECK_CHARWIDTH  16
+#endif
+
 
 PPROBLEM coinCreateProblemObject()
 {
@@ -73,11 +102,41 @@ PPROBLEM coinCreateProblemObject()
 	pProblem->SemiIndex    = NULL;
 	pProblem->SemiIndex	   = NULL;
 
+	pProblem->QuadNZCount  = 0;
+	pProblem->QuadBegin    = NULL;
+	pProblem->QuadIndex    = NULL;
+	pProblem->QuadValues   = NULL;
+
+	pProblem->BlockCount   = 0;
+	pProblem->ColBlock     = NULL;
+	pProblem->RowBlock     = NULL;
+
+	pProblem->ScenCount     = 0;
+	pProblem->ScenProb      = NULL;
+	pProblem->ScenRhsBegin  = NULL;
+	pProblem->ScenRhsIndex  = NULL;
+	pProblem->ScenRhsValues = NULL;
+	pProblem->ScenObjBegin  = NULL;
+	pProblem->ScenObjIndex  = NULL;
+	pProblem->ScenObjValues = NULL;
+	pProblem->ScenBndBegin  = NULL;
+	pProblem->ScenBndIndex  = NULL;
+	pProblem->ScenBndLower  = NULL;
+	pProblem->ScenBndUpper  = NULL;
+
+	pProblem->HasFingerprint = 0;
+	pProblem->Fingerprint[0] = 0;
+	pProblem->Fingerprint[1] = 0;
+	coinInitCacheKey(&pProblem->ContentHash);
+
 	return pProblem;
 }
 
 
 
+static void coinFreeScenarios(PPROBLEM pProblem);
+
+
 void coinClearProblemObject(PPROBLEM pProblem)
 {
 	if (!pProblem) {
@@ -119,6 +178,15 @@ void coinClearProblemObject(PPROBLEM pProblem)
 	if (pProblem->SosIndex)		free(pProblem->SosIndex);
 	if (pProblem->SosRef)		free(pProblem->SosRef);
 
+	if (pProblem->QuadBegin)	free(pProblem->QuadBegin);
+	if (pProblem->QuadIndex)	free(pProblem->QuadIndex);
+	if (pProblem->QuadValues)	free(pProblem->QuadValues);
+
+	if (pProblem->ColBlock)		free(pProblem->ColBlock);
+	if (pProblem->RowBlock)		free(pProblem->RowBlock);
+
+	coinFreeScenarios(pProblem);
+
 	free(pProblem);
 }
 
@@ -189,6 +257,22 @@ int coinStoreMatrix(PPROBLEM pProblem,	int ColCount, int RowCount, int NZCount,
 	if (!coinComputeRowLowerUpper(pProblem, DBL_MAX)) {
 		return 0;
 	}
+
+	coinHashCacheKey(&pProblem->ContentHash, &pProblem->ColCount, sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, &pProblem->RowCount, sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, &pProblem->NZCount, sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, &pProblem->ObjectSense, sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, &pProblem->ObjectConst, sizeof(double));
+	coinHashCacheKey(&pProblem->ContentHash, ObjectCoeffs, ObjectCoeffs ? ColCount * sizeof(double) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, LowerBounds, LowerBounds ? ColCount * sizeof(double) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, UpperBounds, UpperBounds ? ColCount * sizeof(double) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, RowType, RowType ? RowCount * sizeof(char) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, RHSValues, RHSValues ? RowCount * sizeof(double) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, RangeValues, RangeValues ? RowCount * sizeof(double) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, MatrixBegin, MatrixBegin ? (ColCount+1) * sizeof(int) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, MatrixCount, MatrixCount ? ColCount * sizeof(int) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, MatrixIndex, MatrixIndex ? NZCount * sizeof(int) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, MatrixValues, MatrixValues ? NZCount * sizeof(double) : 0);
 	return 1;
 }
 
@@ -255,6 +339,7 @@ int coinStoreInitValues(PPROBLEM pProblem, double* InitValues)
 		return 0;
 	}
 	memcpy(pProblem->InitValues, InitValues, pProblem->ColCount * sizeof(double));
+	coinHashCacheKey(&pProblem->ContentHash, InitValues, pProblem->ColCount * sizeof(double));
 	return 1;
 }
 
@@ -274,6 +359,7 @@ int coinStoreInteger(PPROBLEM pProblem, const char* ColType)
 		return 0;
 	}
 	memcpy(pProblem->ColType, ColType, pProblem->ColCount * sizeof(char));
+	coinHashCacheKey(&pProblem->ContentHash, ColType, pProblem->ColCount * sizeof(char));
 	numInts = coinComputeIntVariables(pProblem);
 	pProblem->SolveAsMIP = (numInts > 0);
 	return 1;
@@ -299,7 +385,10 @@ int coinStorePriority(PPROBLEM pProblem, int PriorCount, int* PriorIndex,
 	if (PriorIndex)  memcpy(pProblem->PriorIndex,  PriorIndex,  PriorCount * sizeof(int));
 	if (PriorValues) memcpy(pProblem->PriorValues, PriorValues, PriorCount * sizeof(int));
 	if (PriorBranch) memcpy(pProblem->PriorBranch, PriorBranch, PriorCount * sizeof(int));
-	return 0;
+	coinHashCacheKey(&pProblem->ContentHash, PriorIndex, PriorIndex ? PriorCount * sizeof(int) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, PriorValues, PriorValues ? PriorCount * sizeof(int) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, PriorBranch, PriorBranch ? PriorCount * sizeof(int) : 0);
+	return 1;
 }
 
 
@@ -331,6 +420,11 @@ int coinStoreSos(PPROBLEM pProblem, int SosCount, int SosNZCount,
 	if (SosBegin) memcpy(pProblem->SosBegin, SosBegin, (SosCount+1) * sizeof(int));
 	if (SosIndex) memcpy(pProblem->SosIndex, SosIndex, SosNZCount   * sizeof(int));
 	if (SosRef)   memcpy(pProblem->SosRef,   SosRef,   SosNZCount   * sizeof(double));
+	coinHashCacheKey(&pProblem->ContentHash, SosType,  SosType  ? SosCount     * sizeof(int) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, SosPrior, SosPrior ? SosCount     * sizeof(int) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, SosBegin, SosBegin ? (SosCount+1) * sizeof(int) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, SosIndex, SosIndex ? SosNZCount   * sizeof(int) : 0);
+	coinHashCacheKey(&pProblem->ContentHash, SosRef,   SosRef   ? SosNZCount   * sizeof(double) : 0);
 
 	pProblem->SolveAsMIP = 1;
 	return 1;
@@ -351,16 +445,295 @@ int coinStoreSemiCont(PPROBLEM pProblem, int SemiCount, int* SemiIndex)
 		return 0;
 	}
 	memcpy(pProblem->SemiIndex, SemiIndex, pProblem->SemiCount * sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, SemiIndex, pProblem->SemiCount * sizeof(int));
 
 	pProblem->SolveAsMIP = 1;
 	return 1;
 }
 
 
+/* The quadratic objective matrix is stored column wise over the columns
+   of the matrix, with one triangle of the symmetric matrix as in the
+   QUADOBJ section of MPS files.  Columns given with QuadCount are packed
+   so that QuadBegin[ColCount] is the element count. */
+
+int coinStoreQuadratic(PPROBLEM pProblem, int* QuadBegin, int* QuadCount,
+				int* QuadIndex, double* QuadValues)
+{
+	int i, k, nz;
+
+	if ((pProblem->ColCount == 0) || !QuadBegin || !QuadIndex || !QuadValues) {
+		return 0;
+	}
+	nz = 0;
+	for (i = 0; i < pProblem->ColCount; i++) {
+		nz += QuadCount ? QuadCount[i] : QuadBegin[i+1] - QuadBegin[i];
+	}
+	if (nz <= 0) {
+		return 0;
+	}
+	if (pProblem->QuadBegin)  free(pProblem->QuadBegin);
+	if (pProblem->QuadIndex)  free(pProblem->QuadIndex);
+	if (pProblem->QuadValues) free(pProblem->QuadValues);
+	pProblem->QuadNZCount = 0;
+	pProblem->QuadBegin  = (int* )malloc((pProblem->ColCount+1) * sizeof(int));
+	pProblem->QuadIndex  = (int* )malloc(nz * sizeof(int));
+	pProblem->QuadValues = (double* )malloc(nz * sizeof(double));
+	if (!pProblem->QuadBegin || !pProblem->QuadIndex || !pProblem->QuadValues) {
+		return 0;
+	}
+	k = 0;
+	for (i = 0; i < pProblem->ColCount; i++) {
+		nz = QuadCount ? QuadCount[i] : QuadBegin[i+1] - QuadBegin[i];
+		pProblem->QuadBegin[i] = k;
+		memcpy(&pProblem->QuadIndex[k], &QuadIndex[QuadBegin[i]], nz * sizeof(int));
+		memcpy(&pProblem->QuadValues[k], &QuadValues[QuadBegin[i]], nz * sizeof(double));
+		k += nz;
+	}
+	pProblem->QuadBegin[pProblem->ColCount] = k;
+	pProblem->QuadNZCount = k;
+	coinHashCacheKey(&pProblem->ContentHash, pProblem->QuadBegin, (pProblem->ColCount+1) * sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, pProblem->QuadIndex, k * sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, pProblem->QuadValues, k * sizeof(double));
+	return 1;
+}
+
+
+/* Block structure for the Benders decomposition, block 0 holds the first
+   stage columns and the rows that only use them, each block from 1 to
+   BlockCount holds the columns and rows of one second stage subproblem.
+   Whether the rows only couple the first stage with their own block is
+   checked when the problem is solved. */
+
+int coinStoreBlocks(PPROBLEM pProblem, int BlockCount, int* ColBlock, int* RowBlock)
+{
+	int i;
+
+	if ((pProblem->ColCount == 0) || (BlockCount <= 0) || !ColBlock || !RowBlock) {
+		return 0;
+	}
+	for (i = 0; i < pProblem->ColCount; i++) {
+		if ((ColBlock[i] < 0) || (ColBlock[i] > BlockCount)) {
+			return 0;
+		}
+	}
+	for (i = 0; i < pProblem->RowCount; i++) {
+		if ((RowBlock[i] < 0) || (RowBlock[i] > BlockCount)) {
+			return 0;
+		}
+	}
+	if (pProblem->ColBlock) free(pProblem->ColBlock);
+	if (pProblem->RowBlock) free(pProblem->RowBlock);
+	pProblem->BlockCount = 0;
+	pProblem->ColBlock = (int* )malloc(pProblem->ColCount * sizeof(int));
+	pProblem->RowBlock = (int* )malloc((pProblem->RowCount ? pProblem->RowCount : 1) * sizeof(int));
+	if (!pProblem->ColBlock || !pProblem->RowBlock) {
+		return 0;
+	}
+	memcpy(pProblem->ColBlock, ColBlock, pProblem->ColCount * sizeof(int));
+	memcpy(pProblem->RowBlock, RowBlock, pProblem->RowCount * sizeof(int));
+	pProblem->BlockCount = BlockCount;
+	coinHashCacheKey(&pProblem->ContentHash, &BlockCount, sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, ColBlock, pProblem->ColCount * sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, RowBlock, pProblem->RowCount * sizeof(int));
+	return 1;
+}
+
+
+/* Scenarios of a two stage stochastic model, the block 1 columns and rows
+   of the core model are its second stage.  Each scenario lists the right
+   hand side, objective and bound values that replace those of the core
+   model, from Begin[s] to Begin[s+1] for scenario s.  Without ScenProb
+   the scenarios are equally likely. */
+
+static void coinFreeScenarios(PPROBLEM pProblem)
+{
+	if (pProblem->ScenProb)      free(pProblem->ScenProb);
+	if (pProblem->ScenRhsBegin)  free(pProblem->ScenRhsBegin);
+	if (pProblem->ScenRhsIndex)  free(pProblem->ScenRhsIndex);
+	if (pProblem->ScenRhsValues) free(pProblem->ScenRhsValues);
+	if (pProblem->ScenObjBegin)  free(pProblem->ScenObjBegin);
+	if (pProblem->ScenObjIndex)  free(pProblem->ScenObjIndex);
+	if (pProblem->ScenObjValues) free(pProblem->ScenObjValues);
+	if (pProblem->ScenBndBegin)  free(pProblem->ScenBndBegin);
+	if (pProblem->ScenBndIndex)  free(pProblem->ScenBndIndex);
+	if (pProblem->ScenBndLower)  free(pProblem->ScenBndLower);
+	if (pProblem->ScenBndUpper)  free(pProblem->ScenBndUpper);
+	pProblem->ScenCount     = 0;
+	pProblem->ScenProb      = NULL;
+	pProblem->ScenRhsBegin  = NULL;
+	pProblem->ScenRhsIndex  = NULL;
+	pProblem->ScenRhsValues = NULL;
+	pProblem->ScenObjBegin  = NULL;
+	pProblem->ScenObjIndex  = NULL;
+	pProblem->ScenObjValues = NULL;
+	pProblem->ScenBndBegin  = NULL;
+	pProblem->ScenBndIndex  = NULL;
+	pProblem->ScenBndLower  = NULL;
+	pProblem->ScenBndUpper  = NULL;
+}
+
+
+static int coinCheckScenarioList(int ScenCount, int IndexCount, int* Begin, int* Index,
+				double* Values, double* Values2)
+{
+	int s, k;
+
+	if (!Begin) {
+		return 1;
+	}
+	if (!Index || !Values || !Values2) {
+		return 0;
+	}
+	for (s = 0; s < ScenCount; s++) {
+		if (Begin[s+1] < Begin[s]) {
+			return 0;
+		}
+	}
+	for (k = Begin[0]; k < Begin[ScenCount]; k++) {
+		if ((Index[k] < 0) || (Index[k] >= IndexCount)) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+
+static int coinCopyScenarioList(PPROBLEM pProblem, int ScenCount, int* Begin, int* Index,
+				double* Values, double* Values2, int** pBegin, int** pIndex,
+				double** pValues, double** pValues2)
+{
+	int s, nz;
+
+	if (!Begin) {
+		return 1;
+	}
+	nz = Begin[ScenCount] - Begin[0];
+	*pBegin = (int* )malloc((ScenCount+1) * sizeof(int));
+	*pIndex = (int* )malloc((nz ? nz : 1) * sizeof(int));
+	*pValues = (double* )malloc((nz ? nz : 1) * sizeof(double));
+	if (pValues2) {
+		*pValues2 = (double* )malloc((nz ? nz : 1) * sizeof(double));
+	}
+	if (!*pBegin || !*pIndex || !*pValues || (pValues2 && !*pValues2)) {
+		return 0;
+	}
+	for (s = 0; s <= ScenCount; s++) {
+		(*pBegin)[s] = Begin[s] - Begin[0];
+	}
+	memcpy(*pIndex, &Index[Begin[0]], nz * sizeof(int));
+	memcpy(*pValues, &Values[Begin[0]], nz * sizeof(double));
+	if (pValues2) {
+		memcpy(*pValues2, &Values2[Begin[0]], nz * sizeof(double));
+	}
+	coinHashCacheKey(&pProblem->ContentHash, *pBegin, (ScenCount+1) * sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, *pIndex, nz * sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, *pValues, nz * sizeof(double));
+	if (pValues2) {
+		coinHashCacheKey(&pProblem->ContentHash, *pValues2, nz * sizeof(double));
+	}
+	return 1;
+}
+
+
+int coinStoreScenarios(PPROBLEM pProblem, int ScenCount, double* ScenProb,
+				int* RhsBegin, int* RhsIndex, double* RhsValues,
+				int* ObjBegin, int* ObjIndex, double* ObjValues,
+				int* BoundBegin, int* BoundIndex, double* LowerValues, double* UpperValues)
+{
+	int s;
+	double probSum;
+
+	if ((pProblem->ColCount == 0) || (ScenCount <= 0)) {
+		return 0;
+	}
+	if (ScenProb) {
+		probSum = 0.0;
+		for (s = 0; s < ScenCount; s++) {
+			if (ScenProb[s] < 0.0) {
+				return 0;
+			}
+			probSum += ScenProb[s];
+		}
+		if ((probSum < 1.0 - 1e-6) || (probSum > 1.0 + 1e-6)) {
+			return 0;
+		}
+	}
+	if ((RhsBegin && !pProblem->RHSValues) ||
+		!coinCheckScenarioList(ScenCount, pProblem->RowCount, RhsBegin, RhsIndex, RhsValues, RhsValues) ||
+		!coinCheckScenarioList(ScenCount, pProblem->ColCount, ObjBegin, ObjIndex, ObjValues, ObjValues) ||
+		!coinCheckScenarioList(ScenCount, pProblem->ColCount, BoundBegin, BoundIndex, LowerValues, UpperValues)) {
+		return 0;
+	}
+	coinFreeScenarios(pProblem);
+	pProblem->ScenProb = (double* )malloc(ScenCount * sizeof(double));
+	if (!pProblem->ScenProb) {
+		return 0;
+	}
+	for (s = 0; s < ScenCount; s++) {
+		pProblem->ScenProb[s] = ScenProb ? ScenProb[s] : 1.0 / ScenCount;
+	}
+	coinHashCacheKey(&pProblem->ContentHash, &ScenCount, sizeof(int));
+	coinHashCacheKey(&pProblem->ContentHash, pProblem->ScenProb, ScenCount * sizeof(double));
+	if (!coinCopyScenarioList(pProblem, ScenCount, RhsBegin, RhsIndex, RhsValues, NULL,
+				&pProblem->ScenRhsBegin, &pProblem->ScenRhsIndex, &pProblem->ScenRhsValues, NULL) ||
+		!coinCopyScenarioList(pProblem, ScenCount, ObjBegin, ObjIndex, ObjValues, NULL,
+				&pProblem->ScenObjBegin, &pProblem->ScenObjIndex, &pProblem->ScenObjValues, NULL) ||
+		!coinCopyScenarioList(pProblem, ScenCount, BoundBegin, BoundIndex, LowerValues, UpperValues,
+				&pProblem->ScenBndBegin, &pProblem->ScenBndIndex, &pProblem->ScenBndLower, &pProblem->ScenBndUpper)) {
+		coinFreeScenarios(pProblem);
+		return 0;
+	}
+	pProblem->ScenCount = ScenCount;
+	return 1;
+}
+
+
+/* Rows are handled in blocks, with OpenMP the blocks of large models are
+   spread over the threads.  The loop bodies have no branches on the row
+   type, only selects, so the compiler can vectorize them. */
+
+#define ROW_BLOCKSIZE     65536
+#define ROW_PARALLELMIN   (4 * ROW_BLOCKSIZE)
+
+#define ROW_INFINITY      1e30
+
+
+static int coinRowLowerUpperBlock(const char* RowType, const double* RHSValues, const double* RangeValues,
+								  double* RowLower, double* RowUpper, int Start, int End, double CoinDblMax)
+{
+	int i;
+	int isL, isG, isE, isR, isN;
+	int invalid = 0;
+	double lowerRHS, upperRHS, RangeValue, RangeABS;
+
+	for (i = Start; i < End; i++) {
+		isL = (RowType[i] == 'L');
+		isG = (RowType[i] == 'G');
+		isE = (RowType[i] == 'E');
+		isR = (RowType[i] == 'R');
+		isN = (RowType[i] == 'N');
+		invalid |= !(isL | isG | isE | isR | isN);
+
+		/* Without RHSValues the row is free except that equality rows are
+		   fixed at zero */
+		lowerRHS = RHSValues ? RHSValues[i] : (isE ? 0.0 : -CoinDblMax);
+		upperRHS = RHSValues ? RHSValues[i] : (isE ? 0.0 : CoinDblMax);
+		RangeValue = (isR && RangeValues) ? RangeValues[i] : 0.0;
+		RangeABS = (RangeValue >= 0.0) ? RangeValue : -RangeValue;
+
+		RowLower[i] = (isG | isE | isR) ? lowerRHS - RangeABS : -CoinDblMax;
+		RowUpper[i] = (isL | isE | isR) ? upperRHS : CoinDblMax;
+	}
+	return !invalid;
+}
+
+
 int coinComputeRowLowerUpper(PPROBLEM pProblem, double CoinDblMax)
 {
 	int i;
-	double RangeABS, RangeValue;
+	int block, blockCount;
+	int invalid = 0;
 
 	if (pProblem->RowCount == 0) {
 		return 0;
@@ -378,38 +751,58 @@ int coinComputeRowLowerUpper(PPROBLEM pProblem, double CoinDblMax)
 		}
 		return 1;
 	}
-	for (i = 0; i < pProblem->RowCount; i++ ){
-		switch (pProblem->RowType[i]) {
-			case 'L':
-				pProblem->RowLower[i] = -CoinDblMax;
-				pProblem->RowUpper[i] = pProblem->RHSValues ? pProblem->RHSValues[i] : CoinDblMax;
-				break;
+	blockCount = (pProblem->RowCount + ROW_BLOCKSIZE - 1) / ROW_BLOCKSIZE;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(|:invalid) if (pProblem->RowCount >= ROW_PARALLELMIN)
+#endif
+	for (block = 0; block < blockCount; block++) {
+		invalid |= !coinRowLowerUpperBlock(pProblem->RowType, pProblem->RHSValues, pProblem->RangeValues,
+						pProblem->RowLower, pProblem->RowUpper, block * ROW_BLOCKSIZE,
+						(block == blockCount - 1) ? pProblem->RowCount : (block + 1) * ROW_BLOCKSIZE,
+						CoinDblMax);
+	}
+	return !invalid;
+}
 
-			case 'G':
-				pProblem->RowLower[i] = pProblem->RHSValues ? pProblem->RHSValues[i] : -CoinDblMax;
-				pProblem->RowUpper[i] = CoinDblMax;
-				break;
 
-			case 'E':
-				pProblem->RowLower[i] = pProblem->RHSValues ? pProblem->RHSValues[i] : 0.0;
-				pProblem->RowUpper[i] = pProblem->RHSValues ? pProblem->RHSValues[i] : 0.0;
-				break;
+/* Slack of each row taken from its bounds, it is the distance to the
+   nearest finite bound so it is non negative when the row is satisfied:
+   RowUpper - activity for 'L' rows, activity - RowLower for 'G' rows and
+   the smaller of the two for range rows.  Equality rows give RHS minus
+   activity and free rows have no slack. */
 
-			case 'R':
-				RangeValue = pProblem->RangeValues ? pProblem->RangeValues[i] : 0.0;
-				RangeABS = (RangeValue >= 0.0) ? RangeValue : -RangeValue;
-				pProblem->RowLower[i] = (pProblem->RHSValues ? pProblem->RHSValues[i] : -CoinDblMax) - RangeABS;
-				pProblem->RowUpper[i] = pProblem->RHSValues ? pProblem->RHSValues[i] : CoinDblMax;
-				break;
+static void coinRowSlackBlock(const double* RowLower, const double* RowUpper, const double* RowActivity,
+							  double* SlackValues, int Start, int End)
+{
+	int i;
+	double upperSlack, lowerSlack, slack;
+
+	for (i = Start; i < End; i++) {
+		upperSlack = RowUpper[i] - RowActivity[i];
+		lowerSlack = RowActivity[i] - RowLower[i];
+		slack = (upperSlack < lowerSlack) ? upperSlack : lowerSlack;
+		slack = (RowLower[i] == RowUpper[i]) ? upperSlack : slack;
+		slack = ((RowLower[i] <= -ROW_INFINITY) && (RowUpper[i] >= ROW_INFINITY)) ? 0.0 : slack;
+		SlackValues[i] = slack;
+	}
+}
 
-			case 'N':
-				pProblem->RowLower[i] = -CoinDblMax;
-				pProblem->RowUpper[i] = CoinDblMax;
-				break;
 
-			default:
-				return 0;
-		}
+int coinComputeRowSlack(PPROBLEM pProblem, const double* RowActivity, double* SlackValues)
+{
+	int block, blockCount;
+
+	if (!pProblem->RowLower || !pProblem->RowUpper || !RowActivity || !SlackValues) {
+		return 0;
+	}
+	blockCount = (pProblem->RowCount + ROW_BLOCKSIZE - 1) / ROW_BLOCKSIZE;
+#ifdef _OPENMP
+#pragma omp parallel for if (pProblem->RowCount >= ROW_PARALLELMIN)
+#endif
+	for (block = 0; block < blockCount; block++) {
+		coinRowSlackBlock(pProblem->RowLower, pProblem->RowUpper, RowActivity, SlackValues,
+						block * ROW_BLOCKSIZE,
+						(block == blockCount - 1) ? pProblem->RowCount : (block + 1) * ROW_BLOCKSIZE);
 	}
 	return 1;
 }
@@ -448,6 +841,589 @@ int coinComputeIntVariables(PPROBLEM pProblem)
 }
 
 
+#define FNV_OFFSET      2166136261U
+#define FNV_PRIME       16777619U
+
+#define FINGER_INFINITY 1e30
+
+
+static void coinHashByte(unsigned int* hash, unsigned char value)
+{
+	hash[0] = (hash[0] ^ value) * FNV_PRIME;
+	hash[1] = ((hash[1] << 5) + hash[1]) ^ value;
+}
+
+
+static void coinHashInt(unsigned int* hash, int value)
+{
+	coinHashByte(hash, (unsigned char)(value & 0xff));
+	coinHashByte(hash, (unsigned char)((value >> 8) & 0xff));
+	coinHashByte(hash, (unsigned char)((value >> 16) & 0xff));
+	coinHashByte(hash, (unsigned char)((value >> 24) & 0xff));
+}
+
+
+/* Fingerprint of the problem structure: dimensions, sparsity pattern, row
+   types and which column bounds are finite or fixed.  Coefficients and
+   bound values are left out, so problems that only differ in their data
+   get the same fingerprint.  Two hashes are kept as a 64 bit value.  It
+   reads the matrix without checks, so it is only computed for problems
+   that passed coinCheckProblem. */
+
+void coinComputeFingerprint(PPROBLEM pProblem)
+{
+	unsigned int hash[2];
+	unsigned char pattern;
+	int i, k;
+
+	hash[0] = FNV_OFFSET;
+	hash[1] = 5381;
+	coinHashInt(hash, pProblem->ColCount);
+	coinHashInt(hash, pProblem->RowCount);
+	coinHashInt(hash, pProblem->NZCount);
+	if (pProblem->MatrixBegin && pProblem->MatrixIndex) {
+		for (i = 0; i < pProblem->ColCount; i++) {
+			coinHashInt(hash, pProblem->MatrixBegin[i+1] - pProblem->MatrixBegin[i]);
+			for (k = pProblem->MatrixBegin[i]; k < pProblem->MatrixBegin[i+1]; k++) {
+				coinHashInt(hash, pProblem->MatrixIndex[k]);
+			}
+		}
+	}
+	if (pProblem->RowType) {
+		for (i = 0; i < pProblem->RowCount; i++) {
+			coinHashByte(hash, (unsigned char)pProblem->RowType[i]);
+		}
+	}
+	for (i = 0; i < pProblem->ColCount; i++) {
+		pattern = 0;
+		if (pProblem->LowerBounds && (pProblem->LowerBounds[i] > -FINGER_INFINITY)) pattern |= 1;
+		if (pProblem->UpperBounds && (pProblem->UpperBounds[i] < FINGER_INFINITY))  pattern |= 2;
+		if (pProblem->LowerBounds && pProblem->UpperBounds &&
+			(pProblem->LowerBounds[i] == pProblem->UpperBounds[i]))                 pattern |= 4;
+		coinHashByte(hash, pattern);
+	}
+	pProblem->Fingerprint[0] = hash[0];
+	pProblem->Fingerprint[1] = hash[1];
+	pProblem->HasFingerprint = 1;
+}
+
+
+/* Problem validation.  Every array is read once, a vector of entries is
+   tested at a time and only a block that holds an error is walked again
+   entry by entry to count the errors and find the first index.  Valid
+   problems, the common case, therefore only run the vector tests. */
+
+#define CHECK_MAXNAMELEN   100
+
+#define CHECK_FINITE  0      /* no NaN or infinite values */
+#define CHECK_NOTNAN  1      /* infinite values allowed */
+
+
+static void coinCheckRecord(PCHECKINFO pCheck, int CheckCode, int Index)
+{
+	if (pCheck->CheckCount[CheckCode] == 0) {
+		pCheck->CheckIndex[CheckCode] = Index;
+	}
+	pCheck->CheckCount[CheckCode]++;
+	pCheck->ErrorCount++;
+}
+
+
+#if defined(COIN_CHECK_AVX2)
+static int coinCheckHasAvx2()
+{
+#if defined(_MSC_VER)
+	int info[4];
+
+	__cpuid(info, 0);
+	if (info[0] < 7) {
+		return 0;
+	}
+	/* OSXSAVE and AVX, and the system must save the YMM registers */
+	__cpuid(info, 1);
+	if (((info[2] & 0x18000000) != 0x18000000) || ((_xgetbv(0) & 6) != 6)) {
+		return 0;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & 0x20) != 0;
+#else
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+
+static void coinCheckTypeBlock(PCHECKINFO pCheck, const char* Types, int Start, int End,
+							   const char* ValidTypes, int CheckCode)
+{
+	int i;
+
+	for (i = Start; i < End; i++) {
+		if (!Types[i] || !strchr(ValidTypes, Types[i])) {
+			coinCheckRecord(pCheck, CheckCode, i);
+		}
+	}
+}
+
+
+#if defined(COIN_CHECK_AVX2)
+static CHECK_AVX2_TARGET int coinCheckTypesAvx2(PCHECKINFO pCheck, const char* Types, int Count,
+											   const char* ValidTypes, int CheckCode)
+{
+	int i, k, validCount = (int)strlen(ValidTypes);
+	__m256i v, ok;
+
+	for (i = 0; i + CHECK_CHARWIDTH <= Count; i += CHECK_CHARWIDTH) {
+		v = _mm256_loadu_si256((const __m256i*)(Types + i));
+		ok = _mm256_setzero_si256();
+		for (k = 0; k < validCount; k++) {
+			ok = _mm256_or_si256(ok, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(ValidTypes[k])));
+		}
+		if (_mm256_movemask_epi8(ok) != -1) {
+			coinCheckTypeBlock(pCheck, Types, i, i + CHECK_CHARWIDTH, ValidTypes, CheckCode);
+		}
+	}
+	return i;
+}
+#endif
+
+
+static void coinCheckTypes(PCHECKINFO pCheck, const char* Types, int Count,
+						   const char* ValidTypes, int CheckCode)
+{
+	int i = 0;
+#if defined(COIN_CHECK_NEON)
+	int k, validCount = (int)strlen(ValidTypes);
+	uint8x16_t v, ok;
+#endif
+
+#if defined(COIN_CHECK_AVX2)
+	if (coinCheckHasAvx2()) {
+		i = coinCheckTypesAvx2(pCheck, Types, Count, ValidTypes, CheckCode);
+	}
+#elif defined(COIN_CHECK_NEON)
+	for (; i + CHECK_CHARWIDTH <= Count; i += CHECK_CHARWIDTH) {
+		v = vld1q_u8((const unsigned char*)(Types + i));
+		ok = vdupq_n_u8(0);
+		for (k = 0; k < validCount; k++) {
+			ok = vorrq_u8(ok, vceqq_u8(v, vdupq_n_u8((unsigned char)ValidTypes[k])));
+		}
+		if (vminvq_u8(ok) == 0) {
+			coinCheckTypeBlock(pCheck, Types, i, i + CHECK_CHARWIDTH, ValidTypes, CheckCode);
+		}
+	}
+#endif
+	coinCheckTypeBlock(pCheck, Types, i, Count, ValidTypes, CheckCode);
+}
+
+
+static void coinCheckIndexBlock(PCHECKINFO pCheck, const int* MatrixIndex, int Start, int End,
+								int RowCount)
+{
+	int k;
+
+	for (k = Start; k < End; k++) {
+		if (MatrixIndex[k] < 0) {
+			coinCheckRecord(pCheck, SOLV_CHECK_MATINDEX, k);
+		}
+		else if (MatrixIndex[k] >= RowCount) {
+			coinCheckRecord(pCheck, SOLV_CHECK_MATINDEXROW, k);
+		}
+	}
+}
+
+
+#if defined(COIN_CHECK_AVX2)
+static CHECK_AVX2_TARGET int coinCheckMatrixIndexAvx2(PCHECKINFO pCheck, const int* MatrixIndex, int NZCount,
+													 int RowCount)
+{
+	int k;
+	__m256i v, bad;
+	__m256i zero = _mm256_setzero_si256();
+	__m256i maxRow = _mm256_set1_epi32(RowCount - 1);
+
+	for (k = 0; k + CHECK_INTWIDTH <= NZCount; k += CHECK_INTWIDTH) {
+		v = _mm256_loadu_si256((const __m256i*)(MatrixIndex + k));
+		bad = _mm256_or_si256(_mm256_cmpgt_epi32(zero, v), _mm256_cmpgt_epi32(v, maxRow));
+		if (!_mm256_testz_si256(bad, bad)) {
+			coinCheckIndexBlock(pCheck, MatrixIndex, k, k + CHECK_INTWIDTH, RowCount);
+		}
+	}
+	return k;
+}
+#endif
+
+
+static void coinCheckMatrixIndex(PCHECKINFO pCheck, const int* MatrixIndex, int NZCount, int RowCount)
+{
+	int k = 0;
+#if defined(COIN_CHECK_NEON)
+	int32x4_t v;
+	uint32x4_t bad;
+	int32x4_t zero = vdupq_n_s32(0);
+	int32x4_t maxRow = vdupq_n_s32(RowCount - 1);
+#endif
+
+#if defined(COIN_CHECK_AVX2)
+	if (coinCheckHasAvx2()) {
+		k = coinCheckMatrixIndexAvx2(pCheck, MatrixIndex, NZCount, RowCount);
+	}
+#elif defined(COIN_CHECK_NEON)
+	for (; k + CHECK_INTWIDTH <= NZCount; k += CHECK_INTWIDTH) {
+		v = vld1q_s32(MatrixIndex + k);
+		bad = vorrq_u32(vcltq_s32(v, zero), vcgtq_s32(v, maxRow));
+		if (vmaxvq_u32(bad) != 0) {
+			coinCheckIndexBlock(pCheck, MatrixIndex, k, k + CHECK_INTWIDTH, RowCount);
+		}
+	}
+#endif
+	coinCheckIndexBlock(pCheck, MatrixIndex, k, NZCount, RowCount);
+}
+
+
+/* MatrixBegin must be non negative and ascending, and when MatrixCount
+   is given it must match the distance between the column starts */
+
+static void coinCheckBeginBlock(PCHECKINFO pCheck, const int* MatrixBegin, const int* MatrixCount,
+								int Start, int End)
+{
+	int i;
+
+	for (i = Start; i < End; i++) {
+		if ((MatrixBegin[i] < 0) || (MatrixBegin[i+1] < MatrixBegin[i])) {
+			coinCheckRecord(pCheck, SOLV_CHECK_MATBEGIN, i);
+		}
+		if (MatrixCount) {
+			if (MatrixCount[i] < 0) {
+				coinCheckRecord(pCheck, SOLV_CHECK_MATCOUNT, i);
+			}
+			else if (MatrixBegin[i+1] - MatrixBegin[i] != MatrixCount[i]) {
+				coinCheckRecord(pCheck, SOLV_CHECK_MATBEGCNT, i);
+			}
+		}
+	}
+}
+
+
+#if defined(COIN_CHECK_AVX2)
+static CHECK_AVX2_TARGET int coinCheckMatrixBeginAvx2(PCHECKINFO pCheck, const int* MatrixBegin,
+													 const int* MatrixCount, int ColCount)
+{
+	int i;
+	__m256i begin, next, count, bad;
+	__m256i zero = _mm256_setzero_si256();
+
+	for (i = 0; i + CHECK_INTWIDTH <= ColCount; i += CHECK_INTWIDTH) {
+		begin = _mm256_loadu_si256((const __m256i*)(MatrixBegin + i));
+		next = _mm256_loadu_si256((const __m256i*)(MatrixBegin + i + 1));
+		bad = _mm256_or_si256(_mm256_cmpgt_epi32(zero, begin), _mm256_cmpgt_epi32(begin, next));
+		if (MatrixCount) {
+			count = _mm256_loadu_si256((const __m256i*)(MatrixCount + i));
+			bad = _mm256_or_si256(bad, _mm256_cmpgt_epi32(zero, count));
+			bad = _mm256_or_si256(bad, _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_sub_epi32(next, begin), count),
+														_mm256_set1_epi32(-1)));
+		}
+		if (!_mm256_testz_si256(bad, bad)) {
+			coinCheckBeginBlock(pCheck, MatrixBegin, MatrixCount, i, i + CHECK_INTWIDTH);
+		}
+	}
+	return i;
+}
+#endif
+
+
+static void coinCheckMatrixBegin(PCHECKINFO pCheck, const int* MatrixBegin, const int* MatrixCount,
+								 int ColCount)
+{
+	int i = 0;
+#if defined(COIN_CHECK_NEON)
+	int32x4_t begin, next, count;
+	uint32x4_t bad;
+	int32x4_t zero = vdupq_n_s32(0);
+#endif
+
+#if defined(COIN_CHECK_AVX2)
+	if (coinCheckHasAvx2()) {
+		i = coinCheckMatrixBeginAvx2(pCheck, MatrixBegin, MatrixCount, ColCount);
+	}
+#elif defined(COIN_CHECK_NEON)
+	for (; i + CHECK_INTWIDTH <= ColCount; i += CHECK_INTWIDTH) {
+		begin = vld1q_s32(MatrixBegin + i);
+		next = vld1q_s32(MatrixBegin + i + 1);
+		bad = vorrq_u32(vcltq_s32(begin, zero), vcgtq_s32(begin, next));
+		if (MatrixCount) {
+			count = vld1q_s32(MatrixCount + i);
+			bad = vorrq_u32(bad, vcltq_s32(count, zero));
+			bad = vorrq_u32(bad, vmvnq_u32(vceqq_s32(vsubq_s32(next, begin), count)));
+		}
+		if (vmaxvq_u32(bad) != 0) {
+			coinCheckBeginBlock(pCheck, MatrixBegin, MatrixCount, i, i + CHECK_INTWIDTH);
+		}
+	}
+#endif
+	coinCheckBeginBlock(pCheck, MatrixBegin, MatrixCount, i, ColCount);
+}
+
+
+/* x - x is zero for finite values only, NaN and infinity both give NaN */
+
+static void coinCheckValueBlock(PCHECKINFO pCheck, const double* Values, int Start, int End,
+								int CheckType, int CheckCode)
+{
+	int k;
+
+	for (k = Start; k < End; k++) {
+		if ((CheckType == CHECK_FINITE) ? (Values[k] - Values[k] != 0.0) : (Values[k] != Values[k])) {
+			coinCheckRecord(pCheck, CheckCode, k);
+		}
+	}
+}
+
+
+#if defined(COIN_CHECK_AVX2)
+static CHECK_AVX2_TARGET int coinCheckValuesAvx2(PCHECKINFO pCheck, const double* Values, int Count,
+												int CheckType, int CheckCode)
+{
+	int k;
+	__m256d v, ok;
+	__m256d zero = _mm256_setzero_pd();
+
+	for (k = 0; k + CHECK_DBLWIDTH <= Count; k += CHECK_DBLWIDTH) {
+		v = _mm256_loadu_pd(Values + k);
+		if (CheckType == CHECK_FINITE) {
+			ok = _mm256_cmp_pd(_mm256_sub_pd(v, v), zero, _CMP_EQ_OQ);
+		}
+		else {
+			ok = _mm256_cmp_pd(v, v, _CMP_ORD_Q);
+		}
+		if (_mm256_movemask_pd(ok) != 0xF) {
+			coinCheckValueBlock(pCheck, Values, k, k + CHECK_DBLWIDTH, CheckType, CheckCode);
+		}
+	}
+	return k;
+}
+#endif
+
+
+static void coinCheckValues(PCHECKINFO pCheck, const double* Values, int Count,
+							int CheckType, int CheckCode)
+{
+	int k = 0;
+#if defined(COIN_CHECK_NEON)
+	float64x2_t v;
+	uint64x2_t ok;
+	float64x2_t zero = vdupq_n_f64(0.0);
+#endif
+
+#if defined(COIN_CHECK_AVX2)
+	if (coinCheckHasAvx2()) {
+		k = coinCheckValuesAvx2(pCheck, Values, Count, CheckType, CheckCode);
+	}
+#elif defined(COIN_CHECK_NEON)
+	for (; k + CHECK_DBLWIDTH <= Count; k += CHECK_DBLWIDTH) {
+		v = vld1q_f64(Values + k);
+		if (CheckType == CHECK_FINITE) {
+			ok = vceqq_f64(vsubq_f64(v, v), zero);
+		}
+		else {
+			ok = vceqq_f64(v, v);
+		}
+		if (vminvq_u32(vreinterpretq_u32_u64(ok)) == 0) {
+			coinCheckValueBlock(pCheck, Values, k, k + CHECK_DBLWIDTH, CheckType, CheckCode);
+		}
+	}
+#endif
+	coinCheckValueBlock(pCheck, Values, k, Count, CheckType, CheckCode);
+}
+
+
+/* Lower bound must not exceed the upper bound, NaN bounds fail the test */
+
+static void coinCheckBoundBlock(PCHECKINFO pCheck, const double* LowerBounds, const double* UpperBounds,
+								int Start, int End)
+{
+	int i;
+
+	for (i = Start; i < End; i++) {
+		if (!(LowerBounds[i] <= UpperBounds[i])) {
+			coinCheckRecord(pCheck, SOLV_CHECK_BOUNDS, i);
+		}
+	}
+}
+
+
+#if defined(COIN_CHECK_AVX2)
+static CHECK_AVX2_TARGET int coinCheckBoundsAvx2(PCHECKINFO pCheck, const double* LowerBounds,
+												const double* UpperBounds, int ColCount)
+{
+	int i;
+	__m256d ok;
+
+	for (i = 0; i + CHECK_DBLWIDTH <= ColCount; i += CHECK_DBLWIDTH) {
+		ok = _mm256_cmp_pd(_mm256_loadu_pd(LowerBounds + i), _mm256_loadu_pd(UpperBounds + i), _CMP_LE_OQ);
+		if (_mm256_movemask_pd(ok) != 0xF) {
+			coinCheckBoundBlock(pCheck, LowerBounds, UpperBounds, i, i + CHECK_DBLWIDTH);
+		}
+	}
+	return i;
+}
+#endif
+
+
+static void coinCheckBounds(PCHECKINFO pCheck, const double* LowerBounds, const double* UpperBounds,
+							int ColCount)
+{
+	int i = 0;
+#if defined(COIN_CHECK_NEON)
+	uint64x2_t ok;
+#endif
+
+#if defined(COIN_CHECK_AVX2)
+	if (coinCheckHasAvx2()) {
+		i = coinCheckBoundsAvx2(pCheck, LowerBounds, UpperBounds, ColCount);
+	}
+#elif defined(COIN_CHECK_NEON)
+	for (; i + CHECK_DBLWIDTH <= ColCount; i += CHECK_DBLWIDTH) {
+		ok = vcleq_f64(vld1q_f64(LowerBounds + i), vld1q_f64(UpperBounds + i));
+		if (vminvq_u32(vreinterpretq_u32_u64(ok)) == 0) {
+			coinCheckBoundBlock(pCheck, LowerBounds, UpperBounds, i, i + CHECK_DBLWIDTH);
+		}
+	}
+#endif
+	coinCheckBoundBlock(pCheck, LowerBounds, UpperBounds, i, ColCount);
+}
+
+
+/* Checks the whole problem and fills in the number of errors and the
+   index of the first offending entry for every SOLV_CHECK_XXX code.
+   Returns the lowest failing code, or 0 when the problem is valid. */
+
+int coinCheckProblem(PPROBLEM pProblem, PCHECKINFO pCheck)
+{
+	int i;
+
+	memset(pCheck, 0, sizeof(CHECKINFO));
+	for (i = 0; i < SOLV_CHECK_COUNT; i++) {
+		pCheck->CheckIndex[i] = -1;
+	}
+	if (pProblem->ColCount == 0) {
+		coinCheckRecord(pCheck, SOLV_CHECK_COLCOUNT, -1);
+	}
+	if ((pProblem->RowCount < 0) ||
+		(pProblem->NZCount < 0) ||
+		(pProblem->RangeCount < 0)) {
+		coinCheckRecord(pCheck, SOLV_CHECK_ROWCOUNT, -1);
+	}
+	if ((pProblem->RangeCount > pProblem->RowCount)) {
+		coinCheckRecord(pCheck, SOLV_CHECK_RANGECOUNT, -1);
+	}
+	if ((pProblem->ObjectSense < -1) || 
+		(pProblem->ObjectSense > 1)) {
+		coinCheckRecord(pCheck, SOLV_CHECK_OBJSENSE, -1);
+	}
+	if (pProblem->RowType && (pProblem->RowCount > 0)) {
+		coinCheckTypes(pCheck, pProblem->RowType, pProblem->RowCount, "LEGRN", SOLV_CHECK_ROWTYPE);
+	}
+	if ((pProblem->NZCount > 0) && pProblem->MatrixBegin && (pProblem->ColCount > 0)) {
+		coinCheckMatrixBegin(pCheck, pProblem->MatrixBegin, pProblem->MatrixCount, pProblem->ColCount);
+		if (pProblem->MatrixBegin[pProblem->ColCount] != pProblem->NZCount) {
+			coinCheckRecord(pCheck, SOLV_CHECK_MATBEGNZ, pProblem->ColCount);
+		}
+	}
+	if ((pProblem->NZCount > 0) && pProblem->MatrixIndex) {
+		coinCheckMatrixIndex(pCheck, pProblem->MatrixIndex, pProblem->NZCount, pProblem->RowCount);
+	}
+	if (pProblem->LowerBounds && pProblem->UpperBounds && (pProblem->ColCount > 0)) {
+		coinCheckBounds(pCheck, pProblem->LowerBounds, pProblem->UpperBounds, pProblem->ColCount);
+	}
+	if (pProblem->ColType && (pProblem->ColCount > 0)) {
+		coinCheckTypes(pCheck, pProblem->ColType, pProblem->ColCount, "CBI", SOLV_CHECK_COLTYPE);
+	}
+	if (pProblem->ColNamesBuf) {
+		if (pProblem->lenColNamesBuf <= 0) {
+			coinCheckRecord(pCheck, SOLV_CHECK_COLNAMES, -1);
+		}
+		if (pProblem->lenColNamesBuf > pProblem->ColCount * CHECK_MAXNAMELEN) {
+			coinCheckRecord(pCheck, SOLV_CHECK_COLNAMESLEN, -1);
+		}
+	}
+	if (pProblem->RowNamesBuf) {
+		if (pProblem->lenRowNamesBuf <= 0) {
+			coinCheckRecord(pCheck, SOLV_CHECK_ROWNAMES, -1);
+		}
+		if (pProblem->lenRowNamesBuf > pProblem->RowCount * CHECK_MAXNAMELEN) {
+			coinCheckRecord(pCheck, SOLV_CHECK_ROWNAMSLEN, -1);
+		}
+	}
+	if ((pProblem->NZCount > 0) && pProblem->MatrixValues) {
+		coinCheckValues(pCheck, pProblem->MatrixValues, pProblem->NZCount, CHECK_FINITE, SOLV_CHECK_MATVALUE);
+	}
+	if (pProblem->ObjectCoeffs && (pProblem->ColCount > 0)) {
+		coinCheckValues(pCheck, pProblem->ObjectCoeffs, pProblem->ColCount, CHECK_FINITE, SOLV_CHECK_OBJCOEFF);
+	}
+	if (pProblem->RHSValues && (pProblem->RowCount > 0)) {
+		coinCheckValues(pCheck, pProblem->RHSValues, pProblem->RowCount, CHECK_NOTNAN, SOLV_CHECK_RHSVALUE);
+	}
+	if (pProblem->RangeValues && (pProblem->RowCount > 0)) {
+		coinCheckValues(pCheck, pProblem->RangeValues, pProblem->RowCount, CHECK_NOTNAN, SOLV_CHECK_RHSVALUE);
+	}
+	for (i = 1; i < SOLV_CHECK_COUNT; i++) {
+		if (pCheck->CheckCount[i] > 0) {
+			pCheck->FirstError = i;
+			break;
+		}
+	}
+	return pCheck->FirstError;
+}
+
+
+double coinGetProblemBytes(PPROBLEM pProblem)
+{
+	double bytes;
+	double colBytes, rowBytes;
+
+	bytes = (double)sizeof(PROBLEMINFO);
+	colBytes = (double)pProblem->ColCount;
+	rowBytes = (double)pProblem->RowCount;
+	if (pProblem->ObjectCoeffs) bytes += colBytes * sizeof(double);
+	if (pProblem->LowerBounds)  bytes += colBytes * sizeof(double);
+	if (pProblem->UpperBounds)  bytes += colBytes * sizeof(double);
+	if (pProblem->RowType)      bytes += rowBytes * sizeof(char);
+	if (pProblem->RHSValues)    bytes += rowBytes * sizeof(double);
+	if (pProblem->RangeValues)  bytes += rowBytes * sizeof(double);
+	if (pProblem->MatrixBegin)  bytes += (colBytes + 1) * sizeof(int);
+	if (pProblem->MatrixCount)  bytes += colBytes * sizeof(int);
+	if (pProblem->MatrixIndex)  bytes += (double)pProblem->NZCount * sizeof(int);
+	if (pProblem->MatrixValues) bytes += (double)pProblem->NZCount * sizeof(double);
+
+	if (pProblem->ColNamesList) bytes += colBytes * sizeof(char*);
+	if (pProblem->RowNamesList) bytes += rowBytes * sizeof(char*);
+	if (pProblem->ColNamesBuf)  bytes += pProblem->lenColNamesBuf;
+	if (pProblem->RowNamesBuf)  bytes += pProblem->lenRowNamesBuf;
+	if (pProblem->ObjectName)   bytes += pProblem->lenObjNameBuf;
+
+	if (pProblem->InitValues)   bytes += colBytes * sizeof(double);
+	if (pProblem->RowLower)     bytes += rowBytes * sizeof(double);
+	if (pProblem->RowUpper)     bytes += rowBytes * sizeof(double);
+	if (pProblem->ColType)      bytes += colBytes * sizeof(char);
+	if (pProblem->IsInt)        bytes += colBytes * sizeof(char);
+
+	bytes += (double)pProblem->PriorCount * 3 * sizeof(int);
+	bytes += (double)pProblem->SosCount * 3 * sizeof(int) + sizeof(int);
+	bytes += (double)pProblem->SosNZCount * (sizeof(int) + sizeof(double));
+	bytes += (double)pProblem->SemiCount * sizeof(int);
+	bytes += (double)pProblem->QuadNZCount * (sizeof(int) + sizeof(double));
+	bytes += (double)(pProblem->QuadBegin ? pProblem->ColCount + 1 : 0) * sizeof(int);
+	if (pProblem->ColBlock)     bytes += colBytes * sizeof(int);
+	if (pProblem->RowBlock)     bytes += rowBytes * sizeof(int);
+	if (pProblem->ScenProb)     bytes += (double)pProblem->ScenCount * (sizeof(double) + 3 * sizeof(int));
+	if (pProblem->ScenRhsBegin) bytes += (double)pProblem->ScenRhsBegin[pProblem->ScenCount] * (sizeof(int) + sizeof(double));
+	if (pProblem->ScenObjBegin) bytes += (double)pProblem->ScenObjBegin[pProblem->ScenCount] * (sizeof(int) + sizeof(double));
+	if (pProblem->ScenBndBegin) bytes += (double)pProblem->ScenBndBegin[pProblem->ScenCount] * (sizeof(int) + 2 * sizeof(double));
+	return bytes;
+}
+
+
 int coinGetLenNameBuf(const char* NameBuf, int Count)
 {
 	int i, len;
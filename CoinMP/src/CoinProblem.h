@@ -5,6 +5,32 @@
 #ifndef _COINPROBLEM_H_
 #define _COINPROBLEM_H_
 
+#include "CoinCache.h"
+
+
+/* Same codes as SOLV_CHECK_XXX in CoinMP.h */
+#define SOLV_CHECK_COLCOUNT     1
+#define SOLV_CHECK_ROWCOUNT     2
+#define SOLV_CHECK_RANGECOUNT   3
+#define SOLV_CHECK_OBJSENSE     4
+#define SOLV_CHECK_ROWTYPE      5
+#define SOLV_CHECK_MATBEGIN     6
+#define SOLV_CHECK_MATCOUNT     7
+#define SOLV_CHECK_MATBEGCNT    8
+#define SOLV_CHECK_MATBEGNZ     9
+#define SOLV_CHECK_MATINDEX    10
+#define SOLV_CHECK_MATINDEXROW 11
+#define SOLV_CHECK_BOUNDS      12
+#define SOLV_CHECK_COLTYPE     13
+#define SOLV_CHECK_COLNAMES    14
+#define SOLV_CHECK_COLNAMESLEN 15
+#define SOLV_CHECK_ROWNAMES    16
+#define SOLV_CHECK_ROWNAMSLEN  17
+#define SOLV_CHECK_MATVALUE    18
+#define SOLV_CHECK_OBJCOEFF    19
+#define SOLV_CHECK_RHSVALUE    20
+#define SOLV_CHECK_COUNT       21
+
 
 typedef struct {
 				char ProblemName[200];
@@ -65,9 +91,44 @@ typedef struct {
 				int SemiCount;
 				int* SemiIndex;
 
+				int QuadNZCount;
+				int* QuadBegin;
+				int* QuadIndex;
+				double* QuadValues;
+
+				int BlockCount;
+				int* ColBlock;
+				int* RowBlock;
+
+				int ScenCount;
+				double* ScenProb;
+				int* ScenRhsBegin;
+				int* ScenRhsIndex;
+				double* ScenRhsValues;
+				int* ScenObjBegin;
+				int* ScenObjIndex;
+				double* ScenObjValues;
+				int* ScenBndBegin;
+				int* ScenBndIndex;
+				double* ScenBndLower;
+				double* ScenBndUpper;
+
+				int HasFingerprint;
+				unsigned int Fingerprint[2];
+				CACHEKEY ContentHash;
+
 				} PROBLEMINFO, *PPROBLEM;
 
 
+/* Same layout as COIN_CHECKREPORT in CoinMP.h */
+typedef struct {
+				int ErrorCount;
+				int FirstError;
+				int CheckCount[SOLV_CHECK_COUNT];
+				int CheckIndex[SOLV_CHECK_COUNT];
+				} CHECKINFO, *PCHECKINFO;
+
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -95,11 +156,25 @@ int coinStoreSos(PPROBLEM pProblem, int SosCount, int SosNZCount,
 				int* SosType, int* SosPrior, int* SosBegin,
 				int* SosIndex, double* SosRef);
 int coinStoreSemiCont(PPROBLEM pProblem, int SemiCount, int* SemiIndex);
+int coinStoreQuadratic(PPROBLEM pProblem, int* QuadBegin, int* QuadCount,
+				int* QuadIndex, double* QuadValues);
+int coinStoreBlocks(PPROBLEM pProblem, int BlockCount, int* ColBlock, int* RowBlock);
+int coinStoreScenarios(PPROBLEM pProblem, int ScenCount, double* ScenProb,
+				int* RhsBegin, int* RhsIndex, double* RhsValues,
+				int* ObjBegin, int* ObjIndex, double* ObjValues,
+				int* BoundBegin, int* BoundIndex, double* LowerValues, double* UpperValues);
 
 int coinComputeRowLowerUpper(PPROBLEM pProblem, double CoinDblMax);
+int coinComputeRowSlack(PPROBLEM pProblem, const double* RowActivity, double* SlackValues);
 
 int coinComputeIntVariables(PPROBLEM pProblem);
 
+void coinComputeFingerprint(PPROBLEM pProblem);
+
+int coinCheckProblem(PPROBLEM pProblem, PCHECKINFO pCheck);
+
+double coinGetProblemBytes(PPROBLEM pProblem);
+
 int coinGetLenNameBuf(const char* NameBuf, int Count);
 int coinGetLenNameListBuf(char** NameList, int Count);
 
@@ -4,6 +4,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 
 #include "CoinResult.h"
 
@@ -37,6 +38,24 @@ PRESULT coinCreateResultObject(void)
 	pResult->ColStatus = NULL;
 	pResult->RowStatus = NULL;
 
+	pResult->ColCapacity = 0;
+	pResult->RowCapacity = 0;
+
+	pResult->IsView = 0;
+	pResult->SolverView = NULL;
+	pResult->ReleaseView = NULL;
+
+	pResult->PoolSize = 0;
+	pResult->PoolCount = 0;
+	pResult->PoolColCount = 0;
+	pResult->PoolObjValue = NULL;
+	pResult->PoolFoundTime = NULL;
+	pResult->PoolColValues = NULL;
+
+	pResult->ScenarioCount = 0;
+
+	memset(&pResult->Stats, 0, sizeof(SOLVESTATS));
+
 	return pResult;
 }
 
@@ -46,6 +65,7 @@ void coinClearResultObject(PRESULT pResult)
 	if (!pResult) {
 		return;
 	}
+	coinReleaseSolutionView(pResult);
 	if (pResult->ColActivity)   free(pResult->ColActivity);
 	if (pResult->ReducedCost)   free(pResult->ReducedCost);
 	if (pResult->RowActivity)   free(pResult->RowActivity);
@@ -54,10 +74,365 @@ void coinClearResultObject(PRESULT pResult)
 
 	if (pResult->ObjLoRange)    free(pResult->ObjLoRange);
 	if (pResult->ObjUpRange)    free(pResult->ObjUpRange);
-	if (pResult->ObjUpRange)    free(pResult->ObjUpRange);
+	if (pResult->RhsLoRange)    free(pResult->RhsLoRange);
 	if (pResult->RhsUpRange)    free(pResult->RhsUpRange);
 
 	if (pResult->ColStatus)     free(pResult->ColStatus);
-	if (pResult->ColStatus)     free(pResult->ColStatus);
+	if (pResult->RowStatus)     free(pResult->RowStatus);
+
+	if (pResult->PoolObjValue)  free(pResult->PoolObjValue);
+	if (pResult->PoolFoundTime) free(pResult->PoolFoundTime);
+	if (pResult->PoolColValues) free(pResult->PoolColValues);
 	free(pResult);
 }
+
+
+static void coinFreeSolutionArray(double** Array)
+{
+	if (*Array) {
+		free(*Array);
+		*Array = NULL;
+	}
+}
+
+
+static int coinReserveSolutionArray(double** Array, int Capacity)
+{
+	if (!*Array) {
+		*Array = (double*)malloc((Capacity > 0 ? Capacity : 1) * sizeof(double));
+	}
+	return (*Array != NULL);
+}
+
+
+/* Sizes the solution arrays for the next solve.  Arrays left by a previous
+   solve are reused when they are large enough, so repeated solves of the
+   same problem do not go through malloc.  A MIP solve only returns the
+   column activities, the LP arrays are released. */
+
+int coinAllocSolutionArrays(PRESULT pResult, int ColCount, int RowCount, int IsMip)
+{
+	coinReleaseSolutionView(pResult);
+	if ((ColCount > pResult->ColCapacity) || (RowCount > pResult->RowCapacity)) {
+		coinFreeSolutionArray(&pResult->ColActivity);
+		coinFreeSolutionArray(&pResult->ReducedCost);
+		coinFreeSolutionArray(&pResult->RowActivity);
+		coinFreeSolutionArray(&pResult->SlackValues);
+		coinFreeSolutionArray(&pResult->ShadowPrice);
+		pResult->ColCapacity = ColCount;
+		pResult->RowCapacity = RowCount;
+	}
+	if (IsMip) {
+		coinFreeSolutionArray(&pResult->ReducedCost);
+		coinFreeSolutionArray(&pResult->RowActivity);
+		coinFreeSolutionArray(&pResult->SlackValues);
+		coinFreeSolutionArray(&pResult->ShadowPrice);
+		return coinReserveSolutionArray(&pResult->ColActivity, pResult->ColCapacity);
+	}
+	return coinReserveSolutionArray(&pResult->ColActivity, pResult->ColCapacity) &&
+		   coinReserveSolutionArray(&pResult->ReducedCost, pResult->ColCapacity) &&
+		   coinReserveSolutionArray(&pResult->RowActivity, pResult->RowCapacity) &&
+		   coinReserveSolutionArray(&pResult->SlackValues, pResult->RowCapacity) &&
+		   coinReserveSolutionArray(&pResult->ShadowPrice, pResult->RowCapacity);
+}
+
+
+/* Points the solution arrays at the arrays of a solver object instead of
+   copying them, the solver object is owned by the result from now on.
+   Slack values are not kept by the solver, they stay in an own array. */
+
+int coinSetSolutionView(PRESULT pResult, void* SolverView, void (*ReleaseView)(void* SolverView),
+				int RowCount, const double* ColActivity, const double* ReducedCost,
+				const double* RowActivity, const double* ShadowPrice)
+{
+	coinReleaseSolutionView(pResult);
+	coinFreeSolutionArray(&pResult->ColActivity);
+	coinFreeSolutionArray(&pResult->ReducedCost);
+	coinFreeSolutionArray(&pResult->RowActivity);
+	coinFreeSolutionArray(&pResult->ShadowPrice);
+	if (RowCount > pResult->RowCapacity) {
+		coinFreeSolutionArray(&pResult->SlackValues);
+		pResult->RowCapacity = RowCount;
+	}
+	if (RowActivity) {
+		if (!coinReserveSolutionArray(&pResult->SlackValues, pResult->RowCapacity)) {
+			return 0;
+		}
+	}
+	else {
+		coinFreeSolutionArray(&pResult->SlackValues);
+	}
+	/* the const casts are safe, arrays of a view are never written */
+	pResult->ColActivity = (double*)ColActivity;
+	pResult->ReducedCost = (double*)ReducedCost;
+	pResult->RowActivity = (double*)RowActivity;
+	pResult->ShadowPrice = (double*)ShadowPrice;
+	pResult->IsView = 1;
+	pResult->SolverView = SolverView;
+	pResult->ReleaseView = ReleaseView;
+	return 1;
+}
+
+
+void coinReleaseSolutionView(PRESULT pResult)
+{
+	if (!pResult->IsView) {
+		return;
+	}
+	pResult->ColActivity = NULL;
+	pResult->ReducedCost = NULL;
+	pResult->RowActivity = NULL;
+	pResult->ShadowPrice = NULL;
+	if (pResult->ReleaseView) {
+		pResult->ReleaseView(pResult->SolverView);
+	}
+	pResult->IsView = 0;
+	pResult->SolverView = NULL;
+	pResult->ReleaseView = NULL;
+}
+
+
+/* Empties the solution pool for the next solve, the arrays are kept when
+   the pool size and column count did not change */
+
+int coinInitSolutionPool(PRESULT pResult, int PoolSize, int ColCount)
+{
+	pResult->PoolCount = 0;
+	if ((PoolSize == pResult->PoolSize) && (ColCount == pResult->PoolColCount)) {
+		return 1;
+	}
+	coinFreeSolutionArray(&pResult->PoolObjValue);
+	coinFreeSolutionArray(&pResult->PoolFoundTime);
+	coinFreeSolutionArray(&pResult->PoolColValues);
+	pResult->PoolSize = 0;
+	pResult->PoolColCount = ColCount;
+	if (PoolSize <= 0) {
+		return 1;
+	}
+	pResult->PoolObjValue = (double*)malloc(PoolSize * sizeof(double));
+	pResult->PoolFoundTime = (double*)malloc(PoolSize * sizeof(double));
+	pResult->PoolColValues = (double*)malloc((size_t)PoolSize * ColCount * sizeof(double));
+	if (!pResult->PoolObjValue || !pResult->PoolFoundTime || !pResult->PoolColValues) {
+		coinFreeSolutionArray(&pResult->PoolObjValue);
+		coinFreeSolutionArray(&pResult->PoolFoundTime);
+		coinFreeSolutionArray(&pResult->PoolColValues);
+		return 0;
+	}
+	pResult->PoolSize = PoolSize;
+	return 1;
+}
+
+
+/* Inserts a solution by objective, a solution already in the pool is not
+   added twice.  When the pool is full the worst solution is dropped. */
+
+int coinAddPoolSolution(PRESULT pResult, int ObjectSense, const double* ColValues,
+				double ObjectValue, double FoundTime)
+{
+	double sense = (ObjectSense < 0) ? -1.0 : 1.0;
+	int colCount = pResult->PoolColCount;
+	int i, pos;
+
+	if ((pResult->PoolSize == 0) || !ColValues) {
+		return 0;
+	}
+	pos = pResult->PoolCount;
+	for (i = 0; i < pResult->PoolCount; i++) {
+		if ((pResult->PoolObjValue[i] == ObjectValue) &&
+			(memcmp(&pResult->PoolColValues[(size_t)i * colCount], ColValues, colCount * sizeof(double)) == 0)) {
+			return 0;
+		}
+		if ((pos == pResult->PoolCount) && (sense * ObjectValue < sense * pResult->PoolObjValue[i])) {
+			pos = i;
+		}
+	}
+	if (pos >= pResult->PoolSize) {
+		return 0;
+	}
+	if (pResult->PoolCount < pResult->PoolSize) {
+		pResult->PoolCount++;
+	}
+	for (i = pResult->PoolCount - 1; i > pos; i--) {
+		pResult->PoolObjValue[i] = pResult->PoolObjValue[i-1];
+		pResult->PoolFoundTime[i] = pResult->PoolFoundTime[i-1];
+		memcpy(&pResult->PoolColValues[(size_t)i * colCount], &pResult->PoolColValues[(size_t)(i-1) * colCount],
+			   colCount * sizeof(double));
+	}
+	pResult->PoolObjValue[pos] = ObjectValue;
+	pResult->PoolFoundTime[pos] = FoundTime;
+	memcpy(&pResult->PoolColValues[(size_t)pos * colCount], ColValues, colCount * sizeof(double));
+	return 1;
+}
+
+
+/* Drops the solutions whose objective is more than the relative PoolGap
+   away from the best solution */
+
+void coinTrimSolutionPool(PRESULT pResult, int ObjectSense, double PoolGap)
+{
+	double sense = (ObjectSense < 0) ? -1.0 : 1.0;
+	double best, limit;
+	int i;
+
+	if (pResult->PoolCount == 0) {
+		return;
+	}
+	best = pResult->PoolObjValue[0];
+	limit = PoolGap * ((best >= 1.0 || best <= -1.0) ? (best >= 0.0 ? best : -best) : 1.0);
+	for (i = 1; i < pResult->PoolCount; i++) {
+		if (sense * (pResult->PoolObjValue[i] - best) > limit) {
+			pResult->PoolCount = i;
+			break;
+		}
+	}
+}
+
+
+/* Flat copy of a solve result for the solution cache: a fixed header
+   followed by the solution arrays that are present */
+
+typedef struct {
+				int SolutionStatus;
+				char SolutionText[200];
+				double ObjectValue;
+				double MipBestBound;
+				int IterCount;
+				int MipNodeCount;
+				int IsMip;
+				} RESULTHEADER;
+
+
+/* Size of the saved result, computed as a double since it is kept in an
+   int and large problems would overflow it */
+
+static double coinGetResultDataSize(int ColCount, int RowCount, int IsMip)
+{
+	double size;
+
+	size = (double)sizeof(RESULTHEADER) + (double)ColCount * sizeof(double);
+	if (!IsMip) {
+		size += (double)ColCount * sizeof(double) + 3.0 * RowCount * sizeof(double);
+	}
+	return size;
+}
+
+
+int coinSaveResultData(PRESULT pResult, int ColCount, int RowCount, char** Data, int* DataSize)
+{
+	RESULTHEADER header;
+	char* data;
+	double size;
+
+	if (!pResult->ColActivity) {
+		return 0;
+	}
+	memset(&header, 0, sizeof(RESULTHEADER));
+	header.SolutionStatus = pResult->SolutionStatus;
+	strcpy(header.SolutionText, pResult->SolutionText);
+	header.ObjectValue = pResult->ObjectValue;
+	header.MipBestBound = pResult->MipBestBound;
+	header.IterCount = pResult->IterCount;
+	header.MipNodeCount = pResult->MipNodeCount;
+	header.IsMip = (pResult->ReducedCost == NULL);
+
+	size = coinGetResultDataSize(ColCount, RowCount, header.IsMip);
+	if (size > INT_MAX) {
+		return 0;
+	}
+	data = (char*)malloc((size_t)size);
+	if (!data) {
+		return 0;
+	}
+	memcpy(data, &header, sizeof(RESULTHEADER));
+	*DataSize = sizeof(RESULTHEADER);
+	memcpy(data + *DataSize, pResult->ColActivity, ColCount * sizeof(double));
+	*DataSize += ColCount * sizeof(double);
+	if (!header.IsMip) {
+		memcpy(data + *DataSize, pResult->ReducedCost, ColCount * sizeof(double));
+		*DataSize += ColCount * sizeof(double);
+		memcpy(data + *DataSize, pResult->RowActivity, RowCount * sizeof(double));
+		*DataSize += RowCount * sizeof(double);
+		memcpy(data + *DataSize, pResult->SlackValues, RowCount * sizeof(double));
+		*DataSize += RowCount * sizeof(double);
+		memcpy(data + *DataSize, pResult->ShadowPrice, RowCount * sizeof(double));
+		*DataSize += RowCount * sizeof(double);
+	}
+	*Data = data;
+	return 1;
+}
+
+
+int coinLoadResultData(PRESULT pResult, int ColCount, int RowCount, const char* Data, int DataSize)
+{
+	RESULTHEADER header;
+
+	if (DataSize < (int)sizeof(RESULTHEADER)) {
+		return 0;
+	}
+	memcpy(&header, Data, sizeof(RESULTHEADER));
+	if (((double)DataSize != coinGetResultDataSize(ColCount, RowCount, header.IsMip)) || !coinAllocSolutionArrays(pResult, ColCount, RowCount, header.IsMip)) {
+		return 0;
+	}
+	pResult->PoolCount = 0;
+	pResult->ScenarioCount = 0;
+	pResult->SolutionStatus = header.SolutionStatus;
+	header.SolutionText[sizeof(header.SolutionText) - 1] = '\0';
+	strcpy(pResult->SolutionText, header.SolutionText);
+	pResult->ObjectValue = header.ObjectValue;
+	pResult->MipBestBound = header.MipBestBound;
+	pResult->IterCount = header.IterCount;
+	pResult->MipNodeCount = header.MipNodeCount;
+
+	Data += sizeof(RESULTHEADER);
+	memcpy(pResult->ColActivity, Data, ColCount * sizeof(double));
+	Data += ColCount * sizeof(double);
+	if (!header.IsMip) {
+		memcpy(pResult->ReducedCost, Data, ColCount * sizeof(double));
+		Data += ColCount * sizeof(double);
+		memcpy(pResult->RowActivity, Data, RowCount * sizeof(double));
+		Data += RowCount * sizeof(double);
+		memcpy(pResult->SlackValues, Data, RowCount * sizeof(double));
+		Data += RowCount * sizeof(double);
+		memcpy(pResult->ShadowPrice, Data, RowCount * sizeof(double));
+	}
+	return 1;
+}
+
+
+/* Clears the statistics of the previous solve, the timing of the problem
+   store phase is kept as it is recorded when the problem is loaded */
+
+void coinResetSolveStats(PRESULT pResult)
+{
+	double storeWall, storeCpu;
+
+	storeWall = pResult->Stats.WallTime[COIN_PHASE_STORE];
+	storeCpu = pResult->Stats.CpuTime[COIN_PHASE_STORE];
+	memset(&pResult->Stats, 0, sizeof(SOLVESTATS));
+	pResult->Stats.WallTime[COIN_PHASE_STORE] = storeWall;
+	pResult->Stats.CpuTime[COIN_PHASE_STORE] = storeCpu;
+}
+
+
+double coinGetResultBytes(PRESULT pResult, int ColCount, int RowCount)
+{
+	double bytes;
+
+	bytes = (double)sizeof(RESULTINFO);
+	if (pResult->ColActivity)   bytes += ColCount * sizeof(double);
+	if (pResult->ReducedCost)   bytes += ColCount * sizeof(double);
+	if (pResult->RowActivity)   bytes += RowCount * sizeof(double);
+	if (pResult->SlackValues)   bytes += RowCount * sizeof(double);
+	if (pResult->ShadowPrice)   bytes += RowCount * sizeof(double);
+
+	if (pResult->ObjLoRange)    bytes += ColCount * sizeof(double);
+	if (pResult->ObjUpRange)    bytes += ColCount * sizeof(double);
+	if (pResult->RhsLoRange)    bytes += RowCount * sizeof(double);
+	if (pResult->RhsUpRange)    bytes += RowCount * sizeof(double);
+
+	if (pResult->ColStatus)     bytes += ColCount * sizeof(int);
+	if (pResult->RowStatus)     bytes += RowCount * sizeof(int);
+
+	bytes += (double)pResult->PoolSize * (pResult->PoolColCount + 2) * sizeof(double);
+	return bytes;
+}
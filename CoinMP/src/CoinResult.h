@@ -6,6 +6,46 @@
 #define _COINRESULT_H_
 
 
+#define COIN_PHASE_STORE      0
+#define COIN_PHASE_LOAD       1
+#define COIN_PHASE_OPTIONS    2
+#define COIN_PHASE_PRESOLVE   3
+#define COIN_PHASE_LPSOLVE    4
+#define COIN_PHASE_CUTGEN     5
+#define COIN_PHASE_BRANCH     6
+#define COIN_PHASE_RESULTS    7
+#define COIN_PHASE_COUNT      8
+
+#define COIN_MAX_CUTGEN      16
+
+
+typedef struct {
+				double WallTime[COIN_PHASE_COUNT];
+				double CpuTime[COIN_PHASE_COUNT];
+				double WallStart[COIN_PHASE_COUNT];
+				double CpuStart[COIN_PHASE_COUNT];
+
+				double TotalWallTime;
+				double TotalCpuTime;
+
+				int CutGenCount;
+				char CutGenName[COIN_MAX_CUTGEN][32];
+				double CutGenTime[COIN_MAX_CUTGEN];
+				int CutGenCalls[COIN_MAX_CUTGEN];
+				int CutGenCuts[COIN_MAX_CUTGEN];
+				int CutGenKept[COIN_MAX_CUTGEN];
+				int CutGenColCuts[COIN_MAX_CUTGEN];
+
+				double RootLPObjValue;
+				double RootCutObjValue;
+
+				double ProblemBytes;
+				double ResultBytes;
+
+				int BendersIterCount;
+				} SOLVESTATS, *PSTATS;
+
+
 typedef struct {
 				int SolutionStatus;
 				char SolutionText[200];
@@ -28,6 +68,31 @@ typedef struct {
 
 				int* ColStatus;
 				int* RowStatus;
+
+				int ColCapacity;
+				int RowCapacity;
+
+				/* With a solution view ColActivity, ReducedCost, RowActivity
+				   and ShadowPrice point into the solver object that is kept
+				   in SolverView until ReleaseView is called for it */
+				int IsView;
+				void* SolverView;
+				void (*ReleaseView)(void* SolverView);
+
+				/* MIP solution pool, best solution first, PoolColValues
+				   holds PoolSize rows of ColCount values */
+				int PoolSize;
+				int PoolCount;
+				int PoolColCount;
+				double* PoolObjValue;
+				double* PoolFoundTime;
+				double* PoolColValues;
+
+				/* Scenarios held by the result of a deterministic equivalent,
+				   0 for all other solves */
+				int ScenarioCount;
+
+				SOLVESTATS Stats;
 				} RESULTINFO, *PRESULT;
 
 #ifdef __cplusplus
@@ -39,6 +104,24 @@ PRESULT coinCreateResultObject(void);
 
 void coinClearResultObject(PRESULT pResult);
 
+int coinAllocSolutionArrays(PRESULT pResult, int ColCount, int RowCount, int IsMip);
+
+int coinSetSolutionView(PRESULT pResult, void* SolverView, void (*ReleaseView)(void* SolverView),
+				int RowCount, const double* ColActivity, const double* ReducedCost,
+				const double* RowActivity, const double* ShadowPrice);
+void coinReleaseSolutionView(PRESULT pResult);
+
+int coinInitSolutionPool(PRESULT pResult, int PoolSize, int ColCount);
+int coinAddPoolSolution(PRESULT pResult, int ObjectSense, const double* ColValues,
+				double ObjectValue, double FoundTime);
+void coinTrimSolutionPool(PRESULT pResult, int ObjectSense, double PoolGap);
+
+int coinSaveResultData(PRESULT pResult, int ColCount, int RowCount, char** Data, int* DataSize);
+int coinLoadResultData(PRESULT pResult, int ColCount, int RowCount, const char* Data, int DataSize);
+
+void coinResetSolveStats(PRESULT pResult);
+double coinGetResultBytes(PRESULT pResult, int ColCount, int RowCount);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,489 @@
+
+/*  CoinScenario.c  */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>   /* DBL_MAX */
+#include <limits.h>  /* INT_MAX */
+
+#include "CoinProblem.h"
+#include "CoinScenario.h"
+
+
+#define SCEN_INFINITY   1e30
+
+/* Index of core column or row i in scenario s of the deterministic
+   equivalent, Count2 is the number of second stage entries */
+#define SCEN_INDEX(s, i, Count, Count2, Pos)   ((s) ? (Count) + ((s)-1)*(Count2) + (Pos)[i] : (i))
+
+
+/* The deterministic equivalent keeps the core model in place as scenario
+   0, the second stage columns and rows of each further scenario s follow
+   from column ColCount + (s-1)*n2 and row RowCount + (s-1)*m2 in core
+   order.  First stage columns hold their core entries and then a copy of
+   their second stage entries for every further scenario, so the matrix is
+   written column by column in a single pass. */
+
+static int coinStagePositions(const int* Block, int Count, int* Pos)
+{
+	int i;
+	int count2 = 0;
+
+	for (i = 0; i < Count; i++) {
+		Pos[i] = Block[i] ? count2++ : -1;
+	}
+	return count2;
+}
+
+
+/* The deterministic equivalent keeps the core names, the second stage
+   copies of scenario s are named with the suffix _s.  The returned list
+   holds the suffixed names behind its pointers in a single allocation.
+   A name buffer that would not fit the int length is not built, the
+   deterministic equivalent then stays unnamed. */
+
+static int coinScenarioNamesList(char** CoreList, int Count, int Count2, int S,
+								 const int* Pos, int DeqCount, char*** pDeqList)
+{
+	char** DeqList;
+	char* p;
+	double lenCore, lenStage2;
+	int s, i;
+
+	*pDeqList = NULL;
+	if (!CoreList) {
+		return 1;
+	}
+	lenCore = 0.0;
+	lenStage2 = 0.0;
+	for (i = 0; i < Count; i++) {
+		lenCore += strlen(CoreList[i]) + 1;
+		if (Pos[i] >= 0) {
+			/* room for an underscore and up to ten digits */
+			lenStage2 += strlen(CoreList[i]) + 12;
+		}
+	}
+	if (lenCore + (double)(S-1) * lenStage2 > INT_MAX) {
+		return 1;
+	}
+	DeqList = (char**)malloc(DeqCount * sizeof(char*) + (size_t)((S-1) * lenStage2) + 1);
+	if (!DeqList) {
+		return 0;
+	}
+	p = (char*)(DeqList + DeqCount);
+	for (s = 0; s < S; s++) {
+		for (i = 0; i < Count; i++) {
+			if (s == 0) {
+				DeqList[i] = CoreList[i];
+			}
+			else if (Pos[i] >= 0) {
+				DeqList[SCEN_INDEX(s, i, Count, Count2, Pos)] = p;
+				sprintf(p, "%s_%d", CoreList[i], s);
+				p += strlen(p) + 1;
+			}
+		}
+	}
+	*pDeqList = DeqList;
+	return 1;
+}
+
+
+static int coinFillDeterministicEq(PPROBLEM pCore, PPROBLEM pDeq, int* colPos, int* rowPos)
+{
+	int n = pCore->ColCount;
+	int m = pCore->RowCount;
+	int S = pCore->ScenCount;
+	int n2, m2;
+	int s, t, i, j, k, kk, col, row;
+	int begin, count, rangeCount;
+	double prob;
+	double nz, nzStage2, colCount, rowCount, nzCount;
+	char** colNames;
+	char** rowNames;
+	int result;
+
+	n2 = coinStagePositions(pCore->ColBlock, n, colPos);
+	m2 = coinStagePositions(pCore->RowBlock, m, rowPos);
+	nz = 0.0;
+	nzStage2 = 0.0;
+	for (j = 0; j < n; j++) {
+		begin = pCore->MatrixBegin[j];
+		count = pCore->MatrixCount ? pCore->MatrixCount[j] : pCore->MatrixBegin[j+1] - begin;
+		nz += count;
+		for (k = begin; k < begin + count; k++) {
+			row = pCore->MatrixIndex[k];
+			/* second stage columns may not reach the first stage rows */
+			if ((colPos[j] >= 0) && (rowPos[row] < 0)) {
+				return 0;
+			}
+			if (rowPos[row] >= 0) {
+				nzStage2++;
+			}
+		}
+	}
+	/* the first stage is shared by all scenarios */
+	if (pCore->ScenBndBegin) {
+		for (k = 0; k < pCore->ScenBndBegin[S]; k++) {
+			if (colPos[pCore->ScenBndIndex[k]] < 0) {
+				return 0;
+			}
+		}
+	}
+	if (pCore->ScenRhsBegin) {
+		for (k = 0; k < pCore->ScenRhsBegin[S]; k++) {
+			if (rowPos[pCore->ScenRhsIndex[k]] < 0) {
+				return 0;
+			}
+		}
+	}
+
+	/* the sizes grow with the scenario count, so they are computed in
+	   double, which is exact far beyond INT_MAX.  A deterministic
+	   equivalent that does not fit the int counts, including the
+	   ColCount+1 entries of MatrixBegin, is refused before allocating. */
+	colCount = (double)n + (double)(S-1) * n2;
+	rowCount = (double)m + (double)(S-1) * m2;
+	nzCount = nz + (double)(S-1) * nzStage2;
+	if ((colCount >= INT_MAX) || (rowCount > INT_MAX) || (nzCount > INT_MAX)) {
+		return 0;
+	}
+
+	coinSetProblemName(pDeq, pCore->ProblemName);
+	pDeq->ColCount = (int)colCount;
+	pDeq->RowCount = (int)rowCount;
+	pDeq->NZCount = (int)nzCount;
+	pDeq->ObjectSense = pCore->ObjectSense;
+	pDeq->ObjectConst = pCore->ObjectConst;
+	pDeq->BlockCount = S;
+
+	pDeq->ObjectCoeffs = (double*) malloc(pDeq->ColCount     * sizeof(double));
+	pDeq->LowerBounds  = (double*) malloc(pDeq->ColCount     * sizeof(double));
+	pDeq->UpperBounds  = (double*) malloc(pDeq->ColCount     * sizeof(double));
+	pDeq->MatrixBegin  = (int*)    malloc((pDeq->ColCount+1) * sizeof(int));
+	pDeq->MatrixCount  = (int*)    malloc(pDeq->ColCount     * sizeof(int));
+	pDeq->MatrixIndex  = (int*)    malloc((pDeq->NZCount ? pDeq->NZCount : 1) * sizeof(int));
+	pDeq->MatrixValues = (double*) malloc((pDeq->NZCount ? pDeq->NZCount : 1) * sizeof(double));
+	pDeq->ColBlock     = (int*)    malloc(pDeq->ColCount     * sizeof(int));
+	pDeq->RowBlock     = (int*)    malloc(pDeq->RowCount     * sizeof(int));
+	if (pCore->RowType)     pDeq->RowType     = (char*)   malloc(pDeq->RowCount * sizeof(char));
+	if (pCore->RHSValues)   pDeq->RHSValues   = (double*) malloc(pDeq->RowCount * sizeof(double));
+	if (pCore->RangeValues) pDeq->RangeValues = (double*) malloc(pDeq->RowCount * sizeof(double));
+	if (pCore->ColType)     pDeq->ColType     = (char*)   malloc(pDeq->ColCount * sizeof(char));
+	if (pCore->InitValues)  pDeq->InitValues  = (double*) malloc(pDeq->ColCount * sizeof(double));
+
+	if (!pDeq->ObjectCoeffs || !pDeq->LowerBounds || !pDeq->UpperBounds ||
+		!pDeq->MatrixBegin || !pDeq->MatrixCount || !pDeq->MatrixIndex ||
+		!pDeq->MatrixValues || !pDeq->ColBlock || !pDeq->RowBlock ||
+		(pCore->RowType     && !pDeq->RowType)     ||
+		(pCore->RHSValues   && !pDeq->RHSValues)   ||
+		(pCore->RangeValues && !pDeq->RangeValues) ||
+		(pCore->ColType     && !pDeq->ColType)     ||
+		(pCore->InitValues  && !pDeq->InitValues)) {
+		return 0;
+	}
+
+	kk = 0;
+	for (s = 0; s < S; s++) {
+		for (j = 0; j < n; j++) {
+			if ((s > 0) && (colPos[j] < 0)) {
+				continue;
+			}
+			col = SCEN_INDEX(s, j, n, n2, colPos);
+			begin = pCore->MatrixBegin[j];
+			count = pCore->MatrixCount ? pCore->MatrixCount[j] : pCore->MatrixBegin[j+1] - begin;
+			pDeq->MatrixBegin[col] = kk;
+			for (k = begin; k < begin + count; k++) {
+				pDeq->MatrixIndex[kk] = SCEN_INDEX(s, pCore->MatrixIndex[k], m, m2, rowPos);
+				pDeq->MatrixValues[kk++] = pCore->MatrixValues[k];
+			}
+			if (colPos[j] < 0) {
+				for (t = 1; t < S; t++) {
+					for (k = begin; k < begin + count; k++) {
+						row = pCore->MatrixIndex[k];
+						if (rowPos[row] >= 0) {
+							pDeq->MatrixIndex[kk] = SCEN_INDEX(t, row, m, m2, rowPos);
+							pDeq->MatrixValues[kk++] = pCore->MatrixValues[k];
+						}
+					}
+				}
+			}
+			pDeq->MatrixCount[col] = kk - pDeq->MatrixBegin[col];
+			pDeq->ColBlock[col] = (colPos[j] < 0) ? 0 : s + 1;
+			pDeq->ObjectCoeffs[col] = pCore->ObjectCoeffs ? pCore->ObjectCoeffs[j] : 0.0;
+			pDeq->LowerBounds[col] = pCore->LowerBounds ? pCore->LowerBounds[j] : 0.0;
+			pDeq->UpperBounds[col] = pCore->UpperBounds ? pCore->UpperBounds[j] : DBL_MAX;
+			if (pCore->ColType)    pDeq->ColType[col]    = pCore->ColType[j];
+			if (pCore->InitValues) pDeq->InitValues[col] = pCore->InitValues[j];
+		}
+	}
+	pDeq->MatrixBegin[pDeq->ColCount] = kk;
+
+	rangeCount = 0;
+	for (s = 0; s < S; s++) {
+		for (i = 0; i < m; i++) {
+			if ((s > 0) && (rowPos[i] < 0)) {
+				continue;
+			}
+			row = SCEN_INDEX(s, i, m, m2, rowPos);
+			if (pCore->RowType) {
+				pDeq->RowType[row] = pCore->RowType[i];
+				rangeCount += (pCore->RowType[i] == 'R');
+			}
+			if (pCore->RHSValues)   pDeq->RHSValues[row]   = pCore->RHSValues[i];
+			if (pCore->RangeValues) pDeq->RangeValues[row] = pCore->RangeValues[i];
+			pDeq->RowBlock[row] = (rowPos[i] < 0) ? 0 : s + 1;
+		}
+	}
+	pDeq->RangeCount = rangeCount;
+
+	for (s = 0; s < S; s++) {
+		prob = pCore->ScenProb[s];
+		if (pCore->ScenObjBegin) {
+			for (k = pCore->ScenObjBegin[s]; k < pCore->ScenObjBegin[s+1]; k++) {
+				j = pCore->ScenObjIndex[k];
+				if (colPos[j] >= 0) {
+					pDeq->ObjectCoeffs[SCEN_INDEX(s, j, n, n2, colPos)] = pCore->ScenObjValues[k];
+				}
+				else {
+					/* a first stage cost pays its expected value */
+					pDeq->ObjectCoeffs[j] += prob * (pCore->ScenObjValues[k] -
+										(pCore->ObjectCoeffs ? pCore->ObjectCoeffs[j] : 0.0));
+				}
+			}
+		}
+		if (pCore->ScenBndBegin) {
+			for (k = pCore->ScenBndBegin[s]; k < pCore->ScenBndBegin[s+1]; k++) {
+				col = SCEN_INDEX(s, pCore->ScenBndIndex[k], n, n2, colPos);
+				pDeq->LowerBounds[col] = pCore->ScenBndLower[k];
+				pDeq->UpperBounds[col] = pCore->ScenBndUpper[k];
+			}
+		}
+		if (pCore->ScenRhsBegin) {
+			for (k = pCore->ScenRhsBegin[s]; k < pCore->ScenRhsBegin[s+1]; k++) {
+				pDeq->RHSValues[SCEN_INDEX(s, pCore->ScenRhsIndex[k], m, m2, rowPos)] = pCore->ScenRhsValues[k];
+			}
+		}
+		/* second stage costs are weighted with the scenario probability */
+		for (j = 0; j < n; j++) {
+			if (colPos[j] >= 0) {
+				pDeq->ObjectCoeffs[SCEN_INDEX(s, j, n, n2, colPos)] *= prob;
+			}
+		}
+	}
+
+	if (!coinComputeRowLowerUpper(pDeq, DBL_MAX)) {
+		return 0;
+	}
+	if (pDeq->ColType) {
+		pDeq->SolveAsMIP = (coinComputeIntVariables(pDeq) > 0);
+	}
+	/* priorities only name core columns, they stay on the first copy */
+	if ((pCore->PriorCount > 0) &&
+		!coinStorePriority(pDeq, pCore->PriorCount, pCore->PriorIndex, pCore->PriorValues, pCore->PriorBranch)) {
+		return 0;
+	}
+	if (!coinScenarioNamesList(pCore->ColNamesList, n, n2, S, colPos, pDeq->ColCount, &colNames)) {
+		return 0;
+	}
+	if (!coinScenarioNamesList(pCore->RowNamesList, m, m2, S, rowPos, pDeq->RowCount, &rowNames)) {
+		if (colNames) free(colNames);
+		return 0;
+	}
+	result = coinStoreNamesList(pDeq, colNames, rowNames, pCore->ObjectName);
+	if (colNames) free(colNames);
+	if (rowNames) free(rowNames);
+	return result;
+}
+
+
+/* The second stage columns and rows are block 1 of the core model, the
+   deterministic equivalent numbers the block of scenario s as s+1 so it
+   can be solved with SOLV_METHOD_BENDERS as well */
+
+PPROBLEM coinBuildDeterministicEq(PPROBLEM pCore)
+{
+	PPROBLEM pDeq;
+	int* colPos;
+	int* rowPos;
+	int result;
+
+	if ((pCore->ScenCount == 0) || (pCore->BlockCount != 1) || (pCore->RowCount == 0) ||
+		!pCore->MatrixBegin || !pCore->MatrixIndex || !pCore->MatrixValues ||
+		(pCore->SosCount > 0) || (pCore->SemiCount > 0) || (pCore->QuadNZCount > 0)) {
+		return NULL;
+	}
+	colPos = (int* )malloc(pCore->ColCount * sizeof(int));
+	rowPos = (int* )malloc(pCore->RowCount * sizeof(int));
+	pDeq = coinCreateProblemObject();
+	result = colPos && rowPos && pDeq && coinFillDeterministicEq(pCore, pDeq, colPos, rowPos);
+	if (colPos) free(colPos);
+	if (rowPos) free(rowPos);
+	if (!result) {
+		coinClearProblemObject(pDeq);
+		return NULL;
+	}
+	return pDeq;
+}
+
+
+/* Expected value of one entry, an infinite core value stays and an
+   infinite scenario value makes the result infinite */
+
+static void coinExpectValue(double* Value, double CoreValue, double ScenValue, double Prob)
+{
+	if (fabs(CoreValue) >= SCEN_INFINITY) {
+		return;
+	}
+	if (fabs(ScenValue) >= SCEN_INFINITY) {
+		*Value = ScenValue;
+		return;
+	}
+	if (fabs(*Value) < SCEN_INFINITY) {
+		*Value += Prob * (ScenValue - CoreValue);
+	}
+}
+
+
+static int coinFillExpectedValue(PPROBLEM pCore, PPROBLEM pEv)
+{
+	int S = pCore->ScenCount;
+	int s, i, k;
+	double prob;
+
+	coinSetProblemName(pEv, pCore->ProblemName);
+	if (!coinStoreMatrix(pEv, pCore->ColCount, pCore->RowCount, pCore->NZCount, pCore->RangeCount,
+				pCore->ObjectSense, pCore->ObjectConst, pCore->ObjectCoeffs, pCore->LowerBounds,
+				pCore->UpperBounds, pCore->RowType, pCore->RHSValues, pCore->RangeValues,
+				pCore->MatrixBegin, pCore->MatrixCount, pCore->MatrixIndex, pCore->MatrixValues)) {
+		return 0;
+	}
+	/* arrays left out of the core model start from their defaults */
+	if (pCore->ScenObjBegin && !pEv->ObjectCoeffs) {
+		pEv->ObjectCoeffs = (double* )calloc(pEv->ColCount, sizeof(double));
+		if (!pEv->ObjectCoeffs) {
+			return 0;
+		}
+	}
+	if (pCore->ScenBndBegin && !pEv->LowerBounds) {
+		pEv->LowerBounds = (double* )malloc(pEv->ColCount * sizeof(double));
+		if (!pEv->LowerBounds) {
+			return 0;
+		}
+		for (i = 0; i < pEv->ColCount; i++) {
+			pEv->LowerBounds[i] = 0.0;
+		}
+	}
+	if (pCore->ScenBndBegin && !pEv->UpperBounds) {
+		pEv->UpperBounds = (double* )malloc(pEv->ColCount * sizeof(double));
+		if (!pEv->UpperBounds) {
+			return 0;
+		}
+		for (i = 0; i < pEv->ColCount; i++) {
+			pEv->UpperBounds[i] = DBL_MAX;
+		}
+	}
+
+	for (s = 0; s < S; s++) {
+		prob = pCore->ScenProb[s];
+		if (pCore->ScenObjBegin) {
+			for (k = pCore->ScenObjBegin[s]; k < pCore->ScenObjBegin[s+1]; k++) {
+				i = pCore->ScenObjIndex[k];
+				coinExpectValue(&pEv->ObjectCoeffs[i], pCore->ObjectCoeffs ? pCore->ObjectCoeffs[i] : 0.0,
+								pCore->ScenObjValues[k], prob);
+			}
+		}
+		if (pCore->ScenBndBegin) {
+			for (k = pCore->ScenBndBegin[s]; k < pCore->ScenBndBegin[s+1]; k++) {
+				i = pCore->ScenBndIndex[k];
+				coinExpectValue(&pEv->LowerBounds[i], pCore->LowerBounds ? pCore->LowerBounds[i] : 0.0,
+								pCore->ScenBndLower[k], prob);
+				coinExpectValue(&pEv->UpperBounds[i], pCore->UpperBounds ? pCore->UpperBounds[i] : DBL_MAX,
+								pCore->ScenBndUpper[k], prob);
+			}
+		}
+		if (pCore->ScenRhsBegin) {
+			for (k = pCore->ScenRhsBegin[s]; k < pCore->ScenRhsBegin[s+1]; k++) {
+				i = pCore->ScenRhsIndex[k];
+				coinExpectValue(&pEv->RHSValues[i], pCore->RHSValues[i], pCore->ScenRhsValues[k], prob);
+			}
+		}
+	}
+	/* the row bounds follow the expected right hand side */
+	if (pCore->ScenRhsBegin) {
+		free(pEv->RowLower);
+		free(pEv->RowUpper);
+		pEv->RowLower = NULL;
+		pEv->RowUpper = NULL;
+		if (!coinComputeRowLowerUpper(pEv, DBL_MAX)) {
+			return 0;
+		}
+	}
+
+	if (!coinStoreNamesList(pEv, pCore->ColNamesList, pCore->RowNamesList, pCore->ObjectName) ||
+		(pCore->InitValues && !coinStoreInitValues(pEv, pCore->InitValues)) ||
+		(pCore->ColType && !coinStoreInteger(pEv, pCore->ColType)) ||
+		((pCore->PriorCount > 0) && !coinStorePriority(pEv, pCore->PriorCount, pCore->PriorIndex,
+						pCore->PriorValues, pCore->PriorBranch)) ||
+		((pCore->SosCount > 0) && !coinStoreSos(pEv, pCore->SosCount, pCore->SosNZCount, pCore->SosType,
+						pCore->SosPrior, pCore->SosBegin, pCore->SosIndex, pCore->SosRef)) ||
+		((pCore->SemiCount > 0) && !coinStoreSemiCont(pEv, pCore->SemiCount, pCore->SemiIndex)) ||
+		((pCore->QuadNZCount > 0) && !coinStoreQuadratic(pEv, pCore->QuadBegin, NULL,
+						pCore->QuadIndex, pCore->QuadValues)) ||
+		((pCore->BlockCount > 0) && !coinStoreBlocks(pEv, pCore->BlockCount, pCore->ColBlock, pCore->RowBlock))) {
+		return 0;
+	}
+	return 1;
+}
+
+
+/* The expected value problem is the core model with the expected
+   objective, bounds and right hand side of the scenarios, it has the size
+   of the core model and keeps all its other data */
+
+PPROBLEM coinBuildExpectedValue(PPROBLEM pCore)
+{
+	PPROBLEM pEv;
+
+	if (pCore->ScenCount == 0) {
+		return NULL;
+	}
+	pEv = coinCreateProblemObject();
+	if (!pEv) {
+		return NULL;
+	}
+	if (!coinFillExpectedValue(pCore, pEv)) {
+		coinClearProblemObject(pEv);
+		return NULL;
+	}
+	return pEv;
+}
+
+
+/* Values of one scenario from a solution of the deterministic equivalent,
+   in the column or row layout of the core model */
+
+void coinCopyScenarioValues(PPROBLEM pCore, int Scenario, int IsRow,
+				const double* DeqValues, double* Values)
+{
+	const int* block = IsRow ? pCore->RowBlock : pCore->ColBlock;
+	int count = IsRow ? pCore->RowCount : pCore->ColCount;
+	int count2, offset, pos, i;
+
+	count2 = 0;
+	for (i = 0; i < count; i++) {
+		count2 += (block[i] != 0);
+	}
+	offset = count + (Scenario - 1) * count2;
+	pos = 0;
+	for (i = 0; i < count; i++) {
+		if (block[i] && (Scenario > 0)) {
+			Values[i] = DeqValues[offset + pos++];
+		}
+		else {
+			Values[i] = DeqValues[i];
+		}
+	}
+}
@@ -0,0 +1,30 @@
+
+/*  CoinScenario.h  */
+
+
+#ifndef _COINSCENARIO_H_
+#define _COINSCENARIO_H_
+
+
+/* Same values as SOLV_METHOD_XXX in CoinMP.h */
+#define SOLV_METHOD_DEQ           0x00000200L
+#define SOLV_METHOD_EV            0x00000400L
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+PPROBLEM coinBuildDeterministicEq(PPROBLEM pCore);
+PPROBLEM coinBuildExpectedValue(PPROBLEM pCore);
+
+void coinCopyScenarioValues(PPROBLEM pCore, int Scenario, int IsRow,
+				const double* DeqValues, double* Values);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* _COINSCENARIO_H_ */
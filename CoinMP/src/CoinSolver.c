@@ -7,6 +7,16 @@
 #include "CoinSolver.h"
 
 
+#if defined(_MSC_VER)
+#include <windows.h>
+#define COIN_MEMORY_BARRIER()   MemoryBarrier()
+#elif defined(__GNUC__)
+#define COIN_MEMORY_BARRIER()   __sync_synchronize()
+#else
+#define COIN_MEMORY_BARRIER()
+#endif
+
+
 PSOLVER coinCreateSolverObject()
 {
 	PSOLVER pSolver;
@@ -19,15 +29,25 @@ PSOLVER coinCreateSolverObject()
 	pSolver->MsgLogCB	= NULL;
 	pSolver->LPIterCB	= NULL;
 	pSolver->MipNodeCB	= NULL;
+	pSolver->MipSolutionCB = NULL;
+	pSolver->LazyConCB = NULL;
+	pSolver->UserCutCB = NULL;
+	pSolver->HeuristicCB = NULL;
 
 	pSolver->MsgLogParam = NULL;
 	pSolver->LPIterParam = NULL;
 	pSolver->MipNodeParam = NULL;
+	pSolver->MipSolutionParam = NULL;
+	pSolver->LazyConParam = NULL;
+	pSolver->UserCutParam = NULL;
+	pSolver->HeuristicParam = NULL;
 
 	pSolver->MsgLogCallback = NULL;
 	pSolver->IterCallback = NULL;
 	pSolver->MipNodeCallback = NULL;
 
+	pSolver->CutGenerators = NULL;
+
 	return pSolver;
 }
 
@@ -49,7 +69,239 @@ void coinSetLogFilename(PSOLVER pSolver, const char* LogFilename)
 }
 
 
+/* Any callback, old or new style, that a solve would call */
+
+int coinHasCallbacks(PSOLVER pSolver)
+{
+	return pSolver->MsgLogCB || pSolver->LPIterCB || pSolver->MipNodeCB ||
+		   pSolver->MipSolutionCB || pSolver->LazyConCB || pSolver->UserCutCB ||
+		   pSolver->HeuristicCB || pSolver->MsgLogCallback || pSolver->IterCallback ||
+		   pSolver->MipNodeCallback;
+}
+
+
 const char* coinGetLogFilename(PSOLVER pSolver)
 {
 	return pSolver->LogFilename;
 }
+
+
+/* Sequence lock for the progress snapshot, the sequence is odd while the
+   solver thread is writing and readers retry until they see the same even
+   sequence before and after copying the fields */
+
+static volatile PROGRESSINFO* coinProgressWriteBegin(PSOLVER pSolver)
+{
+	volatile PROGRESSINFO* pProgress = &pSolver->Progress;
+
+	pProgress->Sequence++;
+	COIN_MEMORY_BARRIER();
+	return pProgress;
+}
+
+
+static void coinProgressWriteEnd(volatile PROGRESSINFO* pProgress)
+{
+	COIN_MEMORY_BARRIER();
+	pProgress->Sequence++;
+}
+
+
+void coinBeginProgress(PSOLVER pSolver, double StartTime)
+{
+	volatile PROGRESSINFO* pProgress;
+
+	pProgress = coinProgressWriteBegin(pSolver);
+	pProgress->IsRunning = 1;
+	pProgress->IterCount = 0;
+	pProgress->NodeCount = 0;
+	pProgress->ObjectValue = 0.0;
+	pProgress->BestBound = 0.0;
+	pProgress->BestInteger = 0.0;
+	pProgress->StartTime = StartTime;
+	pProgress->EndTime = 0.0;
+	coinProgressWriteEnd(pProgress);
+}
+
+
+void coinEndProgress(PSOLVER pSolver, double EndTime)
+{
+	volatile PROGRESSINFO* pProgress;
+
+	pProgress = coinProgressWriteBegin(pSolver);
+	pProgress->IsRunning = 0;
+	pProgress->EndTime = EndTime;
+	coinProgressWriteEnd(pProgress);
+}
+
+
+void coinPublishLPProgress(PSOLVER pSolver, int IterCount, double ObjectValue)
+{
+	volatile PROGRESSINFO* pProgress;
+
+	pProgress = coinProgressWriteBegin(pSolver);
+	pProgress->IterCount = IterCount;
+	pProgress->ObjectValue = ObjectValue;
+	coinProgressWriteEnd(pProgress);
+}
+
+
+void coinPublishMipProgress(PSOLVER pSolver, int IterCount, int NodeCount,
+				double BestBound, double BestInteger)
+{
+	volatile PROGRESSINFO* pProgress;
+
+	pProgress = coinProgressWriteBegin(pSolver);
+	pProgress->IterCount = IterCount;
+	pProgress->NodeCount = NodeCount;
+	pProgress->ObjectValue = BestInteger;
+	pProgress->BestBound = BestBound;
+	pProgress->BestInteger = BestInteger;
+	coinProgressWriteEnd(pProgress);
+}
+
+
+void coinReadProgress(PSOLVER pSolver, PPROGRESS pProgress)
+{
+	volatile PROGRESSINFO* pShared = &pSolver->Progress;
+	int sequence;
+
+	for (;;) {
+		sequence = pShared->Sequence;
+		if (sequence & 1) {
+			continue;
+		}
+		COIN_MEMORY_BARRIER();
+		pProgress->IsRunning = pShared->IsRunning;
+		pProgress->IterCount = pShared->IterCount;
+		pProgress->NodeCount = pShared->NodeCount;
+		pProgress->ObjectValue = pShared->ObjectValue;
+		pProgress->BestBound = pShared->BestBound;
+		pProgress->BestInteger = pShared->BestInteger;
+		pProgress->StartTime = pShared->StartTime;
+		pProgress->EndTime = pShared->EndTime;
+		COIN_MEMORY_BARRIER();
+		if (pShared->Sequence == sequence) {
+			break;
+		}
+	}
+	pProgress->Sequence = sequence;
+}
+
+
+void coinInitCutBuffer(PCUTBUF pCutBuf, int ColCount)
+{
+	memset(pCutBuf, 0, sizeof(CUTBUFINFO));
+	pCutBuf->ColCount = ColCount;
+}
+
+
+void coinResetCutBuffer(PCUTBUF pCutBuf)
+{
+	pCutBuf->CutCount = 0;
+	pCutBuf->NZCount = 0;
+}
+
+
+void coinClearCutBuffer(PCUTBUF pCutBuf)
+{
+	if (pCutBuf->CutBegin)  free(pCutBuf->CutBegin);
+	if (pCutBuf->CutLower)  free(pCutBuf->CutLower);
+	if (pCutBuf->CutUpper)  free(pCutBuf->CutUpper);
+	if (pCutBuf->CutIndex)  free(pCutBuf->CutIndex);
+	if (pCutBuf->CutValues) free(pCutBuf->CutValues);
+	coinInitCutBuffer(pCutBuf, pCutBuf->ColCount);
+}
+
+
+static int coinGrowCutRows(PCUTBUF pCutBuf)
+{
+	int newSize;
+	int* cutBegin;
+	double* cutLower;
+	double* cutUpper;
+
+	newSize = (pCutBuf->CutSize > 0) ? 2 * pCutBuf->CutSize : 64;
+	cutBegin = (int*)realloc(pCutBuf->CutBegin, (newSize + 1) * sizeof(int));
+	if (!cutBegin) {
+		return 0;
+	}
+	pCutBuf->CutBegin = cutBegin;
+	cutLower = (double*)realloc(pCutBuf->CutLower, newSize * sizeof(double));
+	if (!cutLower) {
+		return 0;
+	}
+	pCutBuf->CutLower = cutLower;
+	cutUpper = (double*)realloc(pCutBuf->CutUpper, newSize * sizeof(double));
+	if (!cutUpper) {
+		return 0;
+	}
+	pCutBuf->CutUpper = cutUpper;
+	pCutBuf->CutSize = newSize;
+	return 1;
+}
+
+
+static int coinGrowCutElements(PCUTBUF pCutBuf, int NZNeeded)
+{
+	int newSize;
+	int* cutIndex;
+	double* cutValues;
+
+	newSize = (pCutBuf->NZSize > 0) ? 2 * pCutBuf->NZSize : 1024;
+	while (newSize < NZNeeded) {
+		newSize *= 2;
+	}
+	cutIndex = (int*)realloc(pCutBuf->CutIndex, newSize * sizeof(int));
+	if (!cutIndex) {
+		return 0;
+	}
+	pCutBuf->CutIndex = cutIndex;
+	cutValues = (double*)realloc(pCutBuf->CutValues, newSize * sizeof(double));
+	if (!cutValues) {
+		return 0;
+	}
+	pCutBuf->CutValues = cutValues;
+	pCutBuf->NZSize = newSize;
+	return 1;
+}
+
+
+/* Rows with a column index outside the model are rejected as a whole */
+
+int coinAddCutRow(PCUTBUF pCutBuf, int NZCount, const int* ColIndex, const double* Values,
+				double RowLower, double RowUpper)
+{
+	int i, start;
+
+	if ((NZCount < 0) || ((NZCount > 0) && (!ColIndex || !Values))) {
+		return 0;
+	}
+	for (i = 0; i < NZCount; i++) {
+		if ((ColIndex[i] < 0) || (ColIndex[i] >= pCutBuf->ColCount)) {
+			return 0;
+		}
+	}
+	if (pCutBuf->CutCount == pCutBuf->CutSize) {
+		if (!coinGrowCutRows(pCutBuf)) {
+			return 0;
+		}
+	}
+	if (pCutBuf->NZCount + NZCount > pCutBuf->NZSize) {
+		if (!coinGrowCutElements(pCutBuf, pCutBuf->NZCount + NZCount)) {
+			return 0;
+		}
+	}
+	start = pCutBuf->NZCount;
+	if (NZCount > 0) {
+		memcpy(&pCutBuf->CutIndex[start], ColIndex, NZCount * sizeof(int));
+		memcpy(&pCutBuf->CutValues[start], Values, NZCount * sizeof(double));
+	}
+	pCutBuf->CutBegin[pCutBuf->CutCount] = start;
+	pCutBuf->CutLower[pCutBuf->CutCount] = RowLower;
+	pCutBuf->CutUpper[pCutBuf->CutCount] = RowUpper;
+	pCutBuf->CutCount++;
+	pCutBuf->NZCount += NZCount;
+	pCutBuf->CutBegin[pCutBuf->CutCount] = pCutBuf->NZCount;
+	return 1;
+}
@@ -28,6 +28,33 @@ typedef int (SOLVCALL *COIN_MIPNODE_CB)(int    IterCount,
 					int    IsMipImproved,
 					void*  UserParam);
 
+typedef int (SOLVCALL *COIN_MIPSOL_CB)(int    MipNodeCount,
+					double ObjectValue,
+					int    ColCount,
+					const double* ColValues,
+					void*  UserParam);
+
+typedef void *HCUTS;
+
+typedef int (SOLVCALL *COIN_LAZYCON_CB)(int    ColCount,
+					const double* ColValues,
+					double ObjectValue,
+					HCUTS  hCuts,
+					void*  UserParam);
+
+typedef int (SOLVCALL *COIN_USERCUT_CB)(int    ColCount,
+					const double* ColValues,
+					double ObjectValue,
+					int    NodeDepth,
+					HCUTS  hCuts,
+					void*  UserParam);
+
+typedef int (SOLVCALL *COIN_HEURISTIC_CB)(int    MipNodeCount,
+					int    ColCount,
+					const double* ColValues,
+					double* NewColValues,
+					void*  UserParam);
+
 
 /* Depreciated, use COIN_XXX_CB instead */
 typedef int (SOLVCALL  *MSGLOGCALLBACK)(const char* MessageStr);
@@ -44,21 +71,67 @@ typedef int (SOLVCALL *MIPNODECALLBACK)(int    IterCount,
 							   int    IsMipImproved);
 
 
+/* Progress of a running solve, written by the solver thread under a
+   sequence lock so it can be read from other threads at any time */
+
+typedef struct {
+				int Sequence;
+				int IsRunning;
+				int IterCount;
+				int NodeCount;
+				double ObjectValue;
+				double BestBound;
+				double BestInteger;
+				double StartTime;
+				double EndTime;
+				} PROGRESSINFO, *PPROGRESS;
+
+
+/* Cuts returned from a callback in sparse row form, the arrays grow as
+   rows are added and are kept between calls */
+
+typedef struct {
+				int ColCount;
+				int CutCount;
+				int CutSize;
+				int NZCount;
+				int NZSize;
+
+				int* CutBegin;
+				double* CutLower;
+				double* CutUpper;
+				int* CutIndex;
+				double* CutValues;
+				} CUTBUFINFO, *PCUTBUF;
+
+
 typedef struct {
 				char LogFilename[260];
 
 				COIN_MSGLOG_CB	MsgLogCB;
 				COIN_LPITER_CB	LPIterCB;
 				COIN_MIPNODE_CB	MipNodeCB;
+				COIN_MIPSOL_CB	MipSolutionCB;
+				COIN_LAZYCON_CB	LazyConCB;
+				COIN_USERCUT_CB	UserCutCB;
+				COIN_HEURISTIC_CB HeuristicCB;
 
 				void*	MsgLogParam;
 				void*	LPIterParam;
 				void*	MipNodeParam;
+				void*	MipSolutionParam;
+				void*	LazyConParam;
+				void*	UserCutParam;
+				void*	HeuristicParam;
 
 				MSGLOGCALLBACK  MsgLogCallback;
 				ITERCALLBACK    IterCallback;
 				MIPNODECALLBACK MipNodeCallback;
 
+				void* CutGenerators;
+
+				PROGRESSINFO Progress;
+
 				} SOLVERINFO, *PSOLVER;
 
 
@@ -74,6 +147,21 @@ void coinClearSolverObject(PSOLVER pSolver);
 void coinSetLogFilename(PSOLVER pSolver, const char* LogFilename);
 const char* coinGetLogFilename(PSOLVER pSolver);
 
+int  coinHasCallbacks(PSOLVER pSolver);
+
+void coinBeginProgress(PSOLVER pSolver, double StartTime);
+void coinEndProgress(PSOLVER pSolver, double EndTime);
+void coinPublishLPProgress(PSOLVER pSolver, int IterCount, double ObjectValue);
+void coinPublishMipProgress(PSOLVER pSolver, int IterCount, int NodeCount,
+				double BestBound, double BestInteger);
+void coinReadProgress(PSOLVER pSolver, PPROGRESS pProgress);
+
+void coinInitCutBuffer(PCUTBUF pCutBuf, int ColCount);
+void coinResetCutBuffer(PCUTBUF pCutBuf);
+void coinClearCutBuffer(PCUTBUF pCutBuf);
+int  coinAddCutRow(PCUTBUF pCutBuf, int NZCount, const int* ColIndex, const double* Values,
+				double RowLower, double RowUpper);
+
 
 #ifdef __cplusplus
 }
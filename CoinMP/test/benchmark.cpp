@@ -0,0 +1,536 @@
+
+/* benchmark.cpp */
+
+// $Id$
+
+/*  Runs every MPS model in a directory through CoinMP under one or more
+    option sets and reports load time, solve time, iterations, nodes and
+    peak memory per model as CSV or JSON.  A previous CSV report can be
+    given as baseline, slower solves or changed objectives are flagged.
+    On POSIX systems each model runs in a child process so the peak
+    memory belongs to that model alone, on Windows it is not measured
+    and reported as -1.
+
+    benchmark <mpsdir> [-options file]... [-reps n] [-csv file] [-json file]
+              [-baseline file] [-tolerance percent]
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#endif
+
+#include "CoinMP.h"
+
+
+#define BENCH_OPT_REAL      4     /* same as OPT_REAL in CoinOption.h */
+
+#define NOISE_FLOOR_SEC     0.01  /* solve times below this are not compared */
+
+
+struct OptionSet {
+	std::string name;
+	std::vector<std::string> optionNames;
+	std::vector<double> optionValues;
+};
+
+
+struct BenchResult {
+	std::string model;
+	std::string optionSet;
+	int reps;
+	double loadTime;
+	double solveTime;
+	int iterCount;
+	int nodeCount;
+	double objectValue;
+	int solutionStatus;
+	long peakRSS;
+	std::string regression;
+};
+
+
+static double WallClock(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, count;
+
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return (double)count.QuadPart / (double)freq.QuadPart;
+#else
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+
+#ifndef _WIN32
+/* Peak resident set size in kilobytes, macOS reports it in bytes */
+static long PeakRSS(const struct rusage& usage)
+{
+#ifdef __APPLE__
+	return usage.ru_maxrss / 1024;
+#else
+	return usage.ru_maxrss;
+#endif
+}
+#endif
+
+
+static bool HasMpsExtension(const std::string& filename)
+{
+	const char* ext[] = {".mps", ".mps.gz", ".MPS"};
+	size_t i, len;
+
+	for (i = 0; i < sizeof(ext) / sizeof(ext[0]); i++) {
+		len = strlen(ext[i]);
+		if ((filename.size() > len) && (filename.compare(filename.size() - len, len, ext[i]) == 0)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+static std::vector<std::string> ListModels(const std::string& dirname)
+{
+	std::vector<std::string> models;
+
+#ifdef _WIN32
+	struct _finddata_t fileinfo;
+	intptr_t handle;
+	std::string pattern = dirname + "\\*";
+
+	handle = _findfirst(pattern.c_str(), &fileinfo);
+	if (handle != -1) {
+		do {
+			if (HasMpsExtension(fileinfo.name)) {
+				models.push_back(fileinfo.name);
+			}
+		} while (_findnext(handle, &fileinfo) == 0);
+		_findclose(handle);
+	}
+#else
+	DIR* dir;
+	struct dirent* entry;
+
+	dir = opendir(dirname.c_str());
+	if (dir) {
+		while ((entry = readdir(dir)) != NULL) {
+			if (HasMpsExtension(entry->d_name)) {
+				models.push_back(entry->d_name);
+			}
+		}
+		closedir(dir);
+	}
+#endif
+	std::sort(models.begin(), models.end());
+	return models;
+}
+
+
+/* Option set files have one "OptionName value" pair per line, lines
+   starting with # are comments.  The set is named after the file. */
+static bool ReadOptionSet(const char* filename, OptionSet& optionSet)
+{
+	FILE* fp;
+	char line[512];
+	char name[128];
+	double value;
+	const char* base;
+
+	fp = fopen(filename, "r");
+	if (!fp) {
+		fprintf(stderr, "Cannot open option file %s\n", filename);
+		return false;
+	}
+	base = strrchr(filename, '/');
+	if (!base) base = strrchr(filename, '\\');
+	optionSet.name = base ? base + 1 : filename;
+	while (fgets(line, sizeof(line), fp)) {
+		if ((line[0] == '#') || (sscanf(line, "%127s %lf", name, &value) != 2)) {
+			continue;
+		}
+		optionSet.optionNames.push_back(name);
+		optionSet.optionValues.push_back(value);
+	}
+	fclose(fp);
+	return true;
+}
+
+
+static bool ApplyOptionSet(HPROB hProb, const OptionSet& optionSet)
+{
+	size_t i;
+	int optionID;
+
+	for (i = 0; i < optionSet.optionNames.size(); i++) {
+		optionID = CoinLocateOptionName(hProb, optionSet.optionNames[i].c_str());
+		if (optionID == -1) {
+			fprintf(stderr, "Unknown option %s in option set %s\n",
+					optionSet.optionNames[i].c_str(), optionSet.name.c_str());
+			return false;
+		}
+		if (CoinGetOptionType(hProb, optionID) == BENCH_OPT_REAL)
+			CoinSetRealOption(hProb, optionID, optionSet.optionValues[i]);
+		else {
+			CoinSetIntOption(hProb, optionID, (int)optionSet.optionValues[i]);
+		}
+	}
+	return true;
+}
+
+
+static double Median(std::vector<double> values)
+{
+	size_t n = values.size();
+
+	if (n == 0) {
+		return 0.0;
+	}
+	std::sort(values.begin(), values.end());
+	return (n % 2) ? values[n/2] : 0.5 * (values[n/2-1] + values[n/2]);
+}
+
+
+static bool RunModel(const std::string& path, const std::string& model,
+					 const OptionSet& optionSet, int reps, BenchResult& result)
+{
+	HPROB hProb;
+	std::vector<double> loadTimes;
+	std::vector<double> solveTimes;
+	double start;
+	int rep;
+
+	result.model = model;
+	result.optionSet = optionSet.name;
+	result.reps = reps;
+	for (rep = 0; rep < reps; rep++) {
+		hProb = CoinCreateProblem(model.c_str());
+		start = WallClock();
+		if (CoinReadFile(hProb, SOLV_FILE_MPS, path.c_str()) != SOLV_CALL_SUCCESS) {
+			fprintf(stderr, "Cannot read model %s\n", path.c_str());
+			CoinUnloadProblem(hProb);
+			return false;
+		}
+		loadTimes.push_back(WallClock() - start);
+		if (!ApplyOptionSet(hProb, optionSet)) {
+			CoinUnloadProblem(hProb);
+			return false;
+		}
+		start = WallClock();
+		CoinOptimizeProblem(hProb, 0);
+		solveTimes.push_back(WallClock() - start);
+
+		result.iterCount = CoinGetIterCount(hProb);
+		result.nodeCount = CoinGetMipNodeCount(hProb);
+		result.objectValue = CoinGetObjectValue(hProb);
+		result.solutionStatus = CoinGetSolutionStatus(hProb);
+		CoinUnloadProblem(hProb);
+	}
+	result.loadTime = Median(loadTimes);
+	result.solveTime = Median(solveTimes);
+	result.peakRSS = -1;
+	return true;
+}
+
+
+#ifndef _WIN32
+/* The peak resident set size of a process only ever grows, so once the
+   largest model has run every later model would report its size.  The
+   model is therefore run in a child process and its own peak is taken
+   from wait4, the results come back through a pipe. */
+static bool RunModelChild(const std::string& path, const std::string& model,
+						  const OptionSet& optionSet, int reps, BenchResult& result)
+{
+	struct rusage usage;
+	int fds[2];
+	int status;
+	pid_t pid;
+	FILE* fp;
+	bool ok;
+
+	if (pipe(fds) != 0) {
+		return false;
+	}
+	fflush(stdout);
+	fflush(stderr);
+	pid = fork();
+	if (pid < 0) {
+		close(fds[0]);
+		close(fds[1]);
+		return false;
+	}
+	if (pid == 0) {
+		close(fds[0]);
+		ok = RunModel(path, model, optionSet, reps, result);
+		fp = fdopen(fds[1], "w");
+		if (ok && fp) {
+			fprintf(fp, "%.17g %.17g %d %d %.17g %d\n", result.loadTime, result.solveTime,
+					result.iterCount, result.nodeCount, result.objectValue, result.solutionStatus);
+			fclose(fp);
+		}
+		_exit(ok ? 0 : 1);
+	}
+	close(fds[1]);
+	result.model = model;
+	result.optionSet = optionSet.name;
+	result.reps = reps;
+	fp = fdopen(fds[0], "r");
+	if (fp) {
+		ok = fscanf(fp, "%lf %lf %d %d %lf %d", &result.loadTime, &result.solveTime,
+					&result.iterCount, &result.nodeCount, &result.objectValue,
+					&result.solutionStatus) == 6;
+		fclose(fp);
+	}
+	else {
+		ok = false;
+		close(fds[0]);
+	}
+	if (wait4(pid, &status, 0, &usage) != pid) {
+		return false;
+	}
+	if (!WIFEXITED(status)) {
+		fprintf(stderr, "Model %s terminated abnormally\n", path.c_str());
+		return false;
+	}
+	if (!ok || (WEXITSTATUS(status) != 0)) {
+		return false;
+	}
+	result.peakRSS = PeakRSS(usage);
+	return true;
+}
+#endif
+
+
+static const char* CSV_HEADER = "model,optionset,reps,load_sec,solve_sec,iterations,nodes,objective,status,peak_rss_kb,regression";
+
+
+static void WriteCsv(FILE* fp, const std::vector<BenchResult>& results)
+{
+	size_t i;
+
+	fprintf(fp, "%s\n", CSV_HEADER);
+	for (i = 0; i < results.size(); i++) {
+		const BenchResult& r = results[i];
+		fprintf(fp, "%s,%s,%d,%.6f,%.6f,%d,%d,%.12g,%d,%ld,%s\n",
+				r.model.c_str(), r.optionSet.c_str(), r.reps, r.loadTime, r.solveTime,
+				r.iterCount, r.nodeCount, r.objectValue, r.solutionStatus, r.peakRSS,
+				r.regression.c_str());
+	}
+}
+
+
+static void WriteJson(FILE* fp, const std::vector<BenchResult>& results)
+{
+	size_t i;
+
+	fprintf(fp, "[\n");
+	for (i = 0; i < results.size(); i++) {
+		const BenchResult& r = results[i];
+		fprintf(fp, "  {\"model\": \"%s\", \"optionset\": \"%s\", \"reps\": %d, "
+				"\"load_sec\": %.6f, \"solve_sec\": %.6f, \"iterations\": %d, \"nodes\": %d, "
+				"\"objective\": %.12g, \"status\": %d, \"peak_rss_kb\": %ld, \"regression\": \"%s\"}%s\n",
+				r.model.c_str(), r.optionSet.c_str(), r.reps, r.loadTime, r.solveTime,
+				r.iterCount, r.nodeCount, r.objectValue, r.solutionStatus, r.peakRSS,
+				r.regression.c_str(), (i + 1 < results.size()) ? "," : "");
+	}
+	fprintf(fp, "]\n");
+}
+
+
+/* Reads a CSV report written by WriteCsv, keyed on model and option set */
+static bool ReadBaseline(const char* filename, std::map<std::string, BenchResult>& baseline)
+{
+	FILE* fp;
+	char line[1024];
+	char model[256];
+	char optionSet[256];
+	BenchResult r;
+
+	fp = fopen(filename, "r");
+	if (!fp) {
+		fprintf(stderr, "Cannot open baseline %s\n", filename);
+		return false;
+	}
+	while (fgets(line, sizeof(line), fp)) {
+		if (sscanf(line, "%255[^,],%255[^,],%d,%lf,%lf,%d,%d,%lf,%d,%ld",
+				   model, optionSet, &r.reps, &r.loadTime, &r.solveTime, &r.iterCount,
+				   &r.nodeCount, &r.objectValue, &r.solutionStatus, &r.peakRSS) != 10) {
+			continue;   /* header or malformed line */
+		}
+		r.model = model;
+		r.optionSet = optionSet;
+		baseline[r.model + "," + r.optionSet] = r;
+	}
+	fclose(fp);
+	return true;
+}
+
+
+static int CompareBaseline(std::vector<BenchResult>& results,
+						   const std::map<std::string, BenchResult>& baseline, double tolerance)
+{
+	std::map<std::string, BenchResult>::const_iterator it;
+	double objTol;
+	int regressions = 0;
+	size_t i;
+
+	for (i = 0; i < results.size(); i++) {
+		BenchResult& r = results[i];
+		it = baseline.find(r.model + "," + r.optionSet);
+		if (it == baseline.end()) {
+			continue;
+		}
+		const BenchResult& b = it->second;
+		objTol = 1e-6 * (1.0 + fabs(b.objectValue));
+		if (r.solutionStatus != b.solutionStatus) {
+			r.regression = "status";
+		}
+		else if (fabs(r.objectValue - b.objectValue) > objTol) {
+			r.regression = "objective";
+		}
+		else if ((r.solveTime > NOISE_FLOOR_SEC) &&
+				 (r.solveTime > b.solveTime * (1.0 + tolerance / 100.0))) {
+			r.regression = "slower";
+		}
+		if (!r.regression.empty()) {
+			fprintf(stderr, "REGRESSION %s/%s: %s (solve %.4fs vs %.4fs, obj %.12g vs %.12g)\n",
+					r.model.c_str(), r.optionSet.c_str(), r.regression.c_str(),
+					r.solveTime, b.solveTime, r.objectValue, b.objectValue);
+			regressions++;
+		}
+	}
+	return regressions;
+}
+
+
+static void Usage(void)
+{
+	fprintf(stderr, "Usage: benchmark <mpsdir> [-options file]... [-reps n] [-csv file] [-json file]\n"
+					"                 [-baseline file] [-tolerance percent]\n");
+}
+
+
+int main(int argc, char* argv[])
+{
+	std::vector<OptionSet> optionSets;
+	std::vector<BenchResult> results;
+	std::map<std::string, BenchResult> baseline;
+	std::vector<std::string> models;
+	const char* mpsDir = NULL;
+	const char* csvFile = NULL;
+	const char* jsonFile = NULL;
+	const char* baselineFile = NULL;
+	double tolerance = 10.0;
+	int reps = 3;
+	int regressions = 0;
+	size_t i, j;
+	FILE* fp;
+
+	for (i = 1; i < (size_t)argc; i++) {
+		if ((strcmp(argv[i], "-options") == 0) && (i + 1 < (size_t)argc)) {
+			OptionSet optionSet;
+			if (!ReadOptionSet(argv[++i], optionSet)) {
+				return 2;
+			}
+			optionSets.push_back(optionSet);
+		}
+		else if ((strcmp(argv[i], "-reps") == 0) && (i + 1 < (size_t)argc))
+			reps = atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-csv") == 0) && (i + 1 < (size_t)argc))
+			csvFile = argv[++i];
+		else if ((strcmp(argv[i], "-json") == 0) && (i + 1 < (size_t)argc))
+			jsonFile = argv[++i];
+		else if ((strcmp(argv[i], "-baseline") == 0) && (i + 1 < (size_t)argc))
+			baselineFile = argv[++i];
+		else if ((strcmp(argv[i], "-tolerance") == 0) && (i + 1 < (size_t)argc))
+			tolerance = atof(argv[++i]);
+		else if ((argv[i][0] != '-') && !mpsDir)
+			mpsDir = argv[i];
+		else {
+			Usage();
+			return 2;
+		}
+	}
+	if (!mpsDir || (reps < 1)) {
+		Usage();
+		return 2;
+	}
+	if (optionSets.empty()) {
+		OptionSet defaults;
+		defaults.name = "default";
+		optionSets.push_back(defaults);
+	}
+	if (baselineFile && !ReadBaseline(baselineFile, baseline)) {
+		return 2;
+	}
+
+	CoinInitSolver("");
+	models = ListModels(mpsDir);
+	if (models.empty()) {
+		fprintf(stderr, "No MPS models found in %s\n", mpsDir);
+	}
+	for (i = 0; i < models.size(); i++) {
+		std::string path = std::string(mpsDir) + "/" + models[i];
+		for (j = 0; j < optionSets.size(); j++) {
+			BenchResult result;
+#ifdef _WIN32
+			if (RunModel(path, models[i], optionSets[j], reps, result)) {
+#else
+			if (RunModelChild(path, models[i], optionSets[j], reps, result)) {
+#endif
+				fprintf(stderr, "%-24s %-16s load %9.4fs solve %9.4fs iter %8d nodes %8d obj %.12g\n",
+						result.model.c_str(), result.optionSet.c_str(), result.loadTime,
+						result.solveTime, result.iterCount, result.nodeCount, result.objectValue);
+				results.push_back(result);
+			}
+		}
+	}
+	CoinFreeSolver();
+
+	if (baselineFile) {
+		regressions = CompareBaseline(results, baseline, tolerance);
+	}
+	if (csvFile) {
+		fp = fopen(csvFile, "w");
+		if (fp) {
+			WriteCsv(fp, results);
+			fclose(fp);
+		}
+	}
+	if (jsonFile) {
+		fp = fopen(jsonFile, "w");
+		if (fp) {
+			WriteJson(fp, results);
+			fclose(fp);
+		}
+	}
+	if (!csvFile && !jsonFile) {
+		WriteCsv(stdout, results);
+	}
+	if (regressions > 0) {
+		fprintf(stderr, "%d regression(s) against baseline %s\n", regressions, baselineFile);
+		return 1;
+	}
+	return 0;
+}
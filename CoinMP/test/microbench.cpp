@@ -0,0 +1,263 @@
+
+/* microbench.cpp */
+
+// $Id$
+
+/*  Measures the fixed cost of the CoinMP entry points on a 10x10 LP, where
+    the solve itself is negligible.  Each benchmark is repeated with a
+    doubling iteration count until it runs for at least the minimum time,
+    the time per call and calls per second are reported.
+
+    microbench [-mintime sec] [-filter name]
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#include "CoinMP.h"
+
+
+#define MODEL_COLS   10
+#define MODEL_ROWS   10
+#define MODEL_NZ     30
+
+#define TARGET_SOLVES_PER_SEC  50000.0
+
+
+static double WallClock(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, count;
+
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return (double)count.QuadPart / (double)freq.QuadPart;
+#else
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+
+/* Tiny LP: maximize the sum of the columns, every row limits three
+   neighbouring columns */
+
+static double objectCoeffs[MODEL_COLS];
+static double lowerBounds[MODEL_COLS];
+static double upperBounds[MODEL_COLS];
+static char rowType[MODEL_ROWS + 1];
+static double rhsValues[MODEL_ROWS];
+static int matrixBegin[MODEL_COLS + 1];
+static int matrixCount[MODEL_COLS];
+static int matrixIndex[MODEL_NZ];
+static double matrixValues[MODEL_NZ];
+
+
+static void BuildModel(void)
+{
+	int col, row, k, nz = 0;
+
+	for (col = 0; col < MODEL_COLS; col++) {
+		objectCoeffs[col] = 1.0 + col % 3;
+		lowerBounds[col] = 0.0;
+		upperBounds[col] = 1000.0;
+		matrixBegin[col] = nz;
+		for (k = 0; k < 3; k++) {
+			row = (col + MODEL_ROWS - k) % MODEL_ROWS;
+			matrixIndex[nz] = row;
+			matrixValues[nz] = 1.0 + k;
+			nz++;
+		}
+		matrixCount[col] = 3;
+	}
+	matrixBegin[MODEL_COLS] = nz;
+	for (row = 0; row < MODEL_ROWS; row++) {
+		rowType[row] = 'L';
+		rhsValues[row] = 10.0 + row;
+	}
+	rowType[MODEL_ROWS] = '\0';
+}
+
+
+static int LoadModel(HPROB hProb)
+{
+	return CoinLoadProblem(hProb, MODEL_COLS, MODEL_ROWS, MODEL_NZ, 0,
+				SOLV_OBJSENS_MAX, 0.0, objectCoeffs, lowerBounds, upperBounds,
+				rowType, rhsValues, NULL, matrixBegin, matrixCount,
+				matrixIndex, matrixValues, NULL, NULL, "micro");
+}
+
+
+/* Problem shared by the benchmarks that work on an already loaded model */
+static HPROB sharedProb;
+
+
+static void BenchCreateUnload(long iters)
+{
+	HPROB hProb;
+	long i;
+
+	for (i = 0; i < iters; i++) {
+		hProb = CoinCreateProblem("micro");
+		CoinUnloadProblem(hProb);
+	}
+}
+
+
+static void BenchLoadProblem(long iters)
+{
+	HPROB hProb;
+	long i;
+
+	for (i = 0; i < iters; i++) {
+		hProb = CoinCreateProblem("micro");
+		LoadModel(hProb);
+		CoinUnloadProblem(hProb);
+	}
+}
+
+
+static void BenchSetOption(long iters)
+{
+	long i;
+
+	for (i = 0; i < iters; i++) {
+		CoinSetIntOption(sharedProb, COIN_INT_MAXITER, 1000 + (int)(i & 1));
+	}
+}
+
+
+static void BenchOptimize(long iters)
+{
+	long i;
+
+	for (i = 0; i < iters; i++) {
+		CoinOptimizeProblem(sharedProb, 0);
+	}
+}
+
+
+static void BenchGetSolution(long iters)
+{
+	double activity[MODEL_COLS];
+	double reducedCost[MODEL_COLS];
+	double slackValues[MODEL_ROWS];
+	double shadowPrice[MODEL_ROWS];
+	long i;
+
+	for (i = 0; i < iters; i++) {
+		CoinGetSolutionValues(sharedProb, activity, reducedCost, slackValues, shadowPrice);
+	}
+}
+
+
+static void BenchFullSolve(long iters)
+{
+	double activity[MODEL_COLS];
+	HPROB hProb;
+	long i;
+
+	for (i = 0; i < iters; i++) {
+		hProb = CoinCreateProblem("micro");
+		LoadModel(hProb);
+		CoinSetIntOption(hProb, COIN_INT_LOGLEVEL, 0);
+		CoinOptimizeProblem(hProb, 0);
+		CoinGetSolutionValues(hProb, activity, NULL, NULL, NULL);
+		CoinUnloadProblem(hProb);
+	}
+}
+
+
+typedef void (*BENCHFUNC)(long iters);
+
+typedef struct {
+	const char* name;
+	BENCHFUNC func;
+} BENCHMARK;
+
+
+static BENCHMARK benchmarks[] = {
+	{"CreateUnload",  BenchCreateUnload},
+	{"LoadProblem",   BenchLoadProblem},
+	{"SetOption",     BenchSetOption},
+	{"Optimize",      BenchOptimize},
+	{"GetSolution",   BenchGetSolution},
+	{"FullSolve",     BenchFullSolve}
+};
+
+
+/* Returns the calls per second of the benchmark */
+static double RunBenchmark(const BENCHMARK* bench, double minTime)
+{
+	long iters = 1;
+	double start, elapsed;
+
+	for (;;) {
+		start = WallClock();
+		bench->func(iters);
+		elapsed = WallClock() - start;
+		if ((elapsed >= minTime) || (iters >= 1000000000L)) {
+			break;
+		}
+		iters *= 2;
+	}
+	printf("%-16s %12ld %12.0f ns %12.0f /s\n", bench->name, iters,
+		   1e9 * elapsed / iters, iters / elapsed);
+	return iters / elapsed;
+}
+
+
+int main(int argc, char* argv[])
+{
+	const char* filter = NULL;
+	double minTime = 0.5;
+	double fullSolveRate = 0.0;
+	double rate;
+	size_t i;
+
+	for (i = 1; i < (size_t)argc; i++) {
+		if ((strcmp(argv[i], "-mintime") == 0) && (i + 1 < (size_t)argc))
+			minTime = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-filter") == 0) && (i + 1 < (size_t)argc))
+			filter = argv[++i];
+		else {
+			fprintf(stderr, "Usage: microbench [-mintime sec] [-filter name]\n");
+			return 2;
+		}
+	}
+
+	CoinInitSolver("");
+	BuildModel();
+	sharedProb = CoinCreateProblem("micro");
+	LoadModel(sharedProb);
+	CoinSetIntOption(sharedProb, COIN_INT_LOGLEVEL, 0);
+	CoinOptimizeProblem(sharedProb, 0);
+
+	printf("%-16s %12s %15s %14s\n", "Benchmark", "Iterations", "Time", "Rate");
+	for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+		if (filter && !strstr(benchmarks[i].name, filter)) {
+			continue;
+		}
+		rate = RunBenchmark(&benchmarks[i], minTime);
+		if (benchmarks[i].func == BenchFullSolve) {
+			fullSolveRate = rate;
+		}
+	}
+	if (fullSolveRate > 0.0) {
+		printf("\nFull solves per second %.0f, target %.0f: %s\n", fullSolveRate,
+			   TARGET_SOLVES_PER_SEC, (fullSolveRate >= TARGET_SOLVES_PER_SEC) ? "met" : "not met");
+	}
+
+	CoinUnloadProblem(sharedProb);
+	CoinFreeSolver();
+	return 0;
+}
@@ -0,0 +1,278 @@
+
+/* modelgen.cpp */
+
+// $Id$
+
+/*  Synthetic model families for scaling benchmarks.  All families are
+    generated from a fixed seed so the same size always gives the same
+    model.  Sizes are approximate, the generated nonzero count is returned
+    in GenModel::nzCount. */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include <algorithm>
+
+#include "CoinMP.h"
+#include "modelgen.h"
+
+
+/* Small linear congruential generator, so models do not depend on the
+   C library rand() implementation */
+static unsigned int NextRandom(unsigned int& seed)
+{
+	seed = seed * 1103515245u + 12345u;
+	return (seed >> 8) & 0xffffff;
+}
+
+
+static int RandomRange(unsigned int& seed, int lo, int hi)
+{
+	return lo + (int)(NextRandom(seed) % (unsigned int)(hi - lo + 1));
+}
+
+
+static void ResetModel(GenModel& model, const char* name, int colCount, int rowCount, long nzReserve)
+{
+	model.name = name;
+	model.colCount = colCount;
+	model.rowCount = rowCount;
+	model.nzCount = 0;
+	model.objectSense = SOLV_OBJSENS_MIN;
+	model.objectCoeffs.assign(colCount, 0.0);
+	model.lowerBounds.assign(colCount, 0.0);
+	model.upperBounds.assign(colCount, 1e37);
+	model.rowType.assign(rowCount, 'L');
+	model.rhsValues.assign(rowCount, 0.0);
+	model.matrixBegin.clear();
+	model.matrixCount.clear();
+	model.matrixIndex.clear();
+	model.matrixValues.clear();
+	model.colType.clear();
+	model.matrixBegin.reserve(colCount + 1);
+	model.matrixCount.reserve(colCount);
+	model.matrixIndex.reserve(nzReserve);
+	model.matrixValues.reserve(nzReserve);
+}
+
+
+static void EndColumn(GenModel& model)
+{
+	int begin = model.matrixBegin.back();
+
+	model.matrixCount.push_back((int)model.matrixIndex.size() - begin);
+}
+
+
+static void FinishModel(GenModel& model)
+{
+	model.nzCount = (int)model.matrixIndex.size();
+	model.matrixBegin.push_back(model.nzCount);
+}
+
+
+/* Transportation: m sources with supply rows (L), n = 4m sinks with demand
+   rows (G), one column per source/sink pair.  Nonzeros = 8m^2. */
+static bool GenerateTransport(long targetNZ, unsigned int seed, GenModel& model)
+{
+	int m = (int)sqrt(targetNZ / 8.0);
+	int n = 4 * m;
+	int i, j;
+	double totalDemand = 0.0;
+
+	if (m < 2) {
+		return false;
+	}
+	ResetModel(model, "transport", m * n, m + n, 2L * m * n);
+	for (j = 0; j < n; j++) {
+		model.rowType[m + j] = 'G';
+		model.rhsValues[m + j] = RandomRange(seed, 10, 100);
+		totalDemand += model.rhsValues[m + j];
+	}
+	/* Supply exceeds demand by about 20 percent */
+	for (i = 0; i < m; i++) {
+		model.rhsValues[i] = ceil(1.2 * totalDemand / m);
+	}
+	for (i = 0; i < m; i++) {
+		for (j = 0; j < n; j++) {
+			model.objectCoeffs[i * n + j] = RandomRange(seed, 1, 50);
+			model.matrixBegin.push_back((int)model.matrixIndex.size());
+			model.matrixIndex.push_back(i);
+			model.matrixValues.push_back(1.0);
+			model.matrixIndex.push_back(m + j);
+			model.matrixValues.push_back(1.0);
+			EndColumn(model);
+		}
+	}
+	FinishModel(model);
+	return true;
+}
+
+
+/* Multi-commodity flow: K commodities routed over a network of N nodes with
+   a bidirectional ring plus 2N random arcs.  One flow conservation row (E)
+   per commodity and node, one shared capacity row (L) per arc, one column
+   per commodity and arc.  Nonzeros = 3 K A with A = 4N. */
+static bool GenerateMultiCommFlow(long targetNZ, unsigned int seed, GenModel& model)
+{
+	const int K = 10;
+	int N = (int)(targetNZ / (12L * K));
+	int A = 4 * N;
+	std::vector<int> tail(A), head(A);
+	std::vector<double> arcCost(A);
+	int a, k, row;
+	int source, sink;
+	double demand, totalDemand = 0.0;
+
+	if (N < 4) {
+		return false;
+	}
+	for (a = 0; a < N; a++) {
+		tail[a] = a;
+		head[a] = (a + 1) % N;
+		tail[N + a] = (a + 1) % N;
+		head[N + a] = a;
+	}
+	for (a = 2 * N; a < A; a++) {
+		tail[a] = RandomRange(seed, 0, N - 1);
+		head[a] = (tail[a] + RandomRange(seed, 1, N - 1)) % N;
+	}
+	for (a = 0; a < A; a++) {
+		arcCost[a] = RandomRange(seed, 1, 20);
+	}
+	ResetModel(model, "multicommflow", K * A, K * N + A, 3L * K * A);
+	for (k = 0; k < K; k++) {
+		source = RandomRange(seed, 0, N - 1);
+		sink = (source + RandomRange(seed, 1, N - 1)) % N;
+		demand = RandomRange(seed, 10, 100);
+		totalDemand += demand;
+		for (row = k * N; row < (k + 1) * N; row++) {
+			model.rowType[row] = 'E';
+		}
+		model.rhsValues[k * N + source] = demand;
+		model.rhsValues[k * N + sink] = -demand;
+	}
+	/* Capacity covers the total demand so every instance is feasible, the
+	   random arcs make some of it binding at the optimum */
+	for (a = 0; a < A; a++) {
+		model.rhsValues[K * N + a] = (a < 2 * N) ? totalDemand : 0.5 * totalDemand;
+	}
+	for (k = 0; k < K; k++) {
+		for (a = 0; a < A; a++) {
+			model.objectCoeffs[k * A + a] = arcCost[a];
+			model.matrixBegin.push_back((int)model.matrixIndex.size());
+			model.matrixIndex.push_back(k * N + std::min(tail[a], head[a]));
+			model.matrixValues.push_back(tail[a] < head[a] ? 1.0 : -1.0);
+			model.matrixIndex.push_back(k * N + std::max(tail[a], head[a]));
+			model.matrixValues.push_back(tail[a] < head[a] ? -1.0 : 1.0);
+			model.matrixIndex.push_back(K * N + a);
+			model.matrixValues.push_back(1.0);
+			EndColumn(model);
+		}
+	}
+	FinishModel(model);
+	return true;
+}
+
+
+/* Set cover: m elements (G rows) and n = 2m binary sets covering about
+   five elements each.  Set j always covers element j mod m so every row
+   can be covered.  Nonzeros = about 10m. */
+static bool GenerateSetCover(long targetNZ, unsigned int seed, GenModel& model)
+{
+	const int perSet = 5;
+	int m = (int)(targetNZ / (2L * perSet));
+	int n = 2 * m;
+	std::vector<int> elements(perSet);
+	int i, j, count;
+
+	if (m < perSet) {
+		return false;
+	}
+	ResetModel(model, "setcover", n, m, (long)perSet * n);
+	model.colType.assign(n, 'B');
+	for (i = 0; i < m; i++) {
+		model.rowType[i] = 'G';
+		model.rhsValues[i] = 1.0;
+	}
+	for (j = 0; j < n; j++) {
+		model.objectCoeffs[j] = RandomRange(seed, 1, 100);
+		model.upperBounds[j] = 1.0;
+		elements[0] = j % m;
+		for (i = 1; i < perSet; i++) {
+			elements[i] = RandomRange(seed, 0, m - 1);
+		}
+		std::sort(elements.begin(), elements.end());
+		count = (int)(std::unique(elements.begin(), elements.end()) - elements.begin());
+		model.matrixBegin.push_back((int)model.matrixIndex.size());
+		for (i = 0; i < count; i++) {
+			model.matrixIndex.push_back(elements[i]);
+			model.matrixValues.push_back(1.0);
+		}
+		EndColumn(model);
+	}
+	FinishModel(model);
+	return true;
+}
+
+
+/* Multi-dimensional knapsack: n binary items with dense weights in ten
+   capacity rows, each row allows about half the total weight.  Profits
+   are correlated with the weights.  Nonzeros = 10n. */
+static bool GenerateKnapsack(long targetNZ, unsigned int seed, GenModel& model)
+{
+	const int R = 10;
+	int n = (int)(targetNZ / R);
+	int i, j;
+	double weight, totalWeight;
+
+	if (n < 2) {
+		return false;
+	}
+	ResetModel(model, "knapsack", n, R, (long)R * n);
+	model.objectSense = SOLV_OBJSENS_MAX;
+	model.colType.assign(n, 'B');
+	for (j = 0; j < n; j++) {
+		model.upperBounds[j] = 1.0;
+		model.matrixBegin.push_back((int)model.matrixIndex.size());
+		totalWeight = 0.0;
+		for (i = 0; i < R; i++) {
+			weight = RandomRange(seed, 1, 100);
+			totalWeight += weight;
+			model.rhsValues[i] += weight;
+			model.matrixIndex.push_back(i);
+			model.matrixValues.push_back(weight);
+		}
+		model.objectCoeffs[j] = totalWeight / R + RandomRange(seed, 0, 10);
+		EndColumn(model);
+	}
+	for (i = 0; i < R; i++) {
+		model.rhsValues[i] = floor(0.5 * model.rhsValues[i]);
+	}
+	FinishModel(model);
+	return true;
+}
+
+
+const char* GenFamilyName(int family)
+{
+	switch (family) {
+		case GEN_TRANSPORT:     return "transport";
+		case GEN_MULTICOMMFLOW: return "multicommflow";
+		case GEN_SETCOVER:      return "setcover";
+		case GEN_KNAPSACK:      return "knapsack";
+	}
+	return "unknown";
+}
+
+
+bool GenerateModel(int family, long targetNZ, unsigned int seed, GenModel& model)
+{
+	switch (family) {
+		case GEN_TRANSPORT:     return GenerateTransport(targetNZ, seed, model);
+		case GEN_MULTICOMMFLOW: return GenerateMultiCommFlow(targetNZ, seed, model);
+		case GEN_SETCOVER:      return GenerateSetCover(targetNZ, seed, model);
+		case GEN_KNAPSACK:      return GenerateKnapsack(targetNZ, seed, model);
+	}
+	return false;
+}
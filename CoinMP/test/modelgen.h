@@ -0,0 +1,49 @@
+
+/* modelgen.h */
+
+// $Id$
+
+/*  Synthetic model families for scaling benchmarks.  Each generator builds
+    a column ordered model sized to roughly the requested number of
+    nonzeros, in the arrays taken by CoinLoadProblem. */
+
+#ifndef _MODELGEN_H_
+#define _MODELGEN_H_
+
+#include <string>
+#include <vector>
+
+
+#define GEN_TRANSPORT      0
+#define GEN_MULTICOMMFLOW  1
+#define GEN_SETCOVER       2
+#define GEN_KNAPSACK       3
+#define GEN_FAMILYCOUNT    4
+
+
+struct GenModel {
+	std::string name;
+	int colCount;
+	int rowCount;
+	int nzCount;
+	int objectSense;
+	std::vector<double> objectCoeffs;
+	std::vector<double> lowerBounds;
+	std::vector<double> upperBounds;
+	std::vector<char> rowType;
+	std::vector<double> rhsValues;
+	std::vector<int> matrixBegin;
+	std::vector<int> matrixCount;
+	std::vector<int> matrixIndex;
+	std::vector<double> matrixValues;
+	std::vector<char> colType;      /* empty for LP families */
+};
+
+
+const char* GenFamilyName(int family);
+
+/* Returns false when the family is unknown or the size is too small */
+bool GenerateModel(int family, long targetNZ, unsigned int seed, GenModel& model);
+
+
+#endif  /* _MODELGEN_H_ */
@@ -0,0 +1,227 @@
+
+/* scalebench.cpp */
+
+// $Id$
+
+/*  Loads synthetic transportation, multi-commodity flow, set cover and
+    knapsack models of growing size straight through CoinLoadProblem and
+    reports the time spent storing the matrix, loading the solver objects,
+    solving and retrieving the results.  For every size after the first
+    the growth exponent of each phase against the previous size is given,
+    values near 1 are linear, values near 2 point to a quadratic path.
+
+    scalebench [-family name]... [-minnz n] [-maxnz n] [-timelimit sec]
+               [-seed n] [-csv file]
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <string>
+#include <vector>
+
+#include "CoinMP.h"
+#include "modelgen.h"
+
+
+#define NOISE_FLOOR_SEC     0.001  /* phases below this get no exponent */
+
+
+struct ScaleResult {
+	std::string family;
+	int colCount;
+	int rowCount;
+	int nzCount;
+	double storeTime;
+	double loadTime;
+	double solveTime;
+	double resultsTime;
+	double problemBytes;
+	double resultBytes;
+	double objectValue;
+	int solutionStatus;
+};
+
+
+static double GrowthExponent(double time, double prevTime, int nz, int prevNZ)
+{
+	if ((time < NOISE_FLOOR_SEC) || (prevTime < NOISE_FLOOR_SEC) || (nz <= prevNZ)) {
+		return 0.0;
+	}
+	return log(time / prevTime) / log((double)nz / (double)prevNZ);
+}
+
+
+static bool RunScaleModel(const GenModel& model, double timeLimit, ScaleResult& result)
+{
+	HPROB hProb;
+	COIN_SOLVESTATS stats;
+	int loadResult;
+
+	hProb = CoinCreateProblem(model.name.c_str());
+	/* CoinLoadProblem does not modify the arrays, the casts only satisfy
+	   the non-const prototype */
+	loadResult = CoinLoadProblem(hProb, model.colCount, model.rowCount, model.nzCount, 0,
+					model.objectSense, 0.0,
+					(double*)&model.objectCoeffs[0], (double*)&model.lowerBounds[0],
+					(double*)&model.upperBounds[0], &model.rowType[0],
+					(double*)&model.rhsValues[0], NULL,
+					(int*)&model.matrixBegin[0], (int*)&model.matrixCount[0],
+					(int*)&model.matrixIndex[0], (double*)&model.matrixValues[0],
+					NULL, NULL, model.name.c_str());
+	if (loadResult != SOLV_CALL_SUCCESS) {
+		fprintf(stderr, "Cannot load model %s\n", model.name.c_str());
+		CoinUnloadProblem(hProb);
+		return false;
+	}
+	if (!model.colType.empty()) {
+		CoinLoadInteger(hProb, &model.colType[0]);
+	}
+	CoinSetRealOption(hProb, COIN_REAL_MAXSECONDS, timeLimit);
+	CoinSetRealOption(hProb, COIN_REAL_MIPMAXSEC, timeLimit);
+	CoinOptimizeProblem(hProb, 0);
+	CoinGetSolveStats(hProb, &stats);
+
+	result.family = model.name;
+	result.colCount = model.colCount;
+	result.rowCount = model.rowCount;
+	result.nzCount = model.nzCount;
+	result.storeTime = stats.WallTime[COIN_PHASE_STORE];
+	result.loadTime = stats.WallTime[COIN_PHASE_LOAD];
+	result.solveTime = stats.WallTime[COIN_PHASE_OPTIONS] + stats.WallTime[COIN_PHASE_PRESOLVE] +
+					   stats.WallTime[COIN_PHASE_LPSOLVE] + stats.WallTime[COIN_PHASE_CUTGEN] +
+					   stats.WallTime[COIN_PHASE_BRANCH];
+	result.resultsTime = stats.WallTime[COIN_PHASE_RESULTS];
+	result.problemBytes = stats.ProblemBytes;
+	result.resultBytes = stats.ResultBytes;
+	result.objectValue = CoinGetObjectValue(hProb);
+	result.solutionStatus = CoinGetSolutionStatus(hProb);
+	CoinUnloadProblem(hProb);
+	return true;
+}
+
+
+static const char* CSV_HEADER = "family,cols,rows,nonzeros,store_sec,load_sec,solve_sec,results_sec,"
+								"store_exp,load_exp,solve_exp,results_exp,problem_bytes,result_bytes,objective,status";
+
+
+static void WriteCsvLine(FILE* fp, const ScaleResult& r, const ScaleResult* prev)
+{
+	double storeExp = 0.0, loadExp = 0.0, solveExp = 0.0, resultsExp = 0.0;
+
+	if (prev) {
+		storeExp = GrowthExponent(r.storeTime, prev->storeTime, r.nzCount, prev->nzCount);
+		loadExp = GrowthExponent(r.loadTime, prev->loadTime, r.nzCount, prev->nzCount);
+		solveExp = GrowthExponent(r.solveTime, prev->solveTime, r.nzCount, prev->nzCount);
+		resultsExp = GrowthExponent(r.resultsTime, prev->resultsTime, r.nzCount, prev->nzCount);
+	}
+	fprintf(fp, "%s,%d,%d,%d,%.6f,%.6f,%.6f,%.6f,%.2f,%.2f,%.2f,%.2f,%.0f,%.0f,%.12g,%d\n",
+			r.family.c_str(), r.colCount, r.rowCount, r.nzCount,
+			r.storeTime, r.loadTime, r.solveTime, r.resultsTime,
+			storeExp, loadExp, solveExp, resultsExp,
+			r.problemBytes, r.resultBytes, r.objectValue, r.solutionStatus);
+}
+
+
+static void Usage(void)
+{
+	fprintf(stderr, "Usage: scalebench [-family name]... [-minnz n] [-maxnz n] [-timelimit sec]\n"
+					"                  [-seed n] [-csv file]\n"
+					"Families: transport multicommflow setcover knapsack (default all)\n");
+}
+
+
+int main(int argc, char* argv[])
+{
+	std::vector<int> families;
+	const char* csvFile = NULL;
+	long minNZ = 1000;
+	long maxNZ = 10000000;
+	double timeLimit = 60.0;
+	unsigned int seed = 12345;
+	long targetNZ;
+	int family;
+	size_t i;
+	FILE* fp = stdout;
+
+	for (i = 1; i < (size_t)argc; i++) {
+		if ((strcmp(argv[i], "-family") == 0) && (i + 1 < (size_t)argc)) {
+			i++;
+			for (family = 0; family < GEN_FAMILYCOUNT; family++) {
+				if (strcmp(argv[i], GenFamilyName(family)) == 0) {
+					break;
+				}
+			}
+			if (family == GEN_FAMILYCOUNT) {
+				Usage();
+				return 2;
+			}
+			families.push_back(family);
+		}
+		else if ((strcmp(argv[i], "-minnz") == 0) && (i + 1 < (size_t)argc))
+			minNZ = atol(argv[++i]);
+		else if ((strcmp(argv[i], "-maxnz") == 0) && (i + 1 < (size_t)argc))
+			maxNZ = atol(argv[++i]);
+		else if ((strcmp(argv[i], "-timelimit") == 0) && (i + 1 < (size_t)argc))
+			timeLimit = atof(argv[++i]);
+		else if ((strcmp(argv[i], "-seed") == 0) && (i + 1 < (size_t)argc))
+			seed = (unsigned int)atol(argv[++i]);
+		else if ((strcmp(argv[i], "-csv") == 0) && (i + 1 < (size_t)argc))
+			csvFile = argv[++i];
+		else {
+			Usage();
+			return 2;
+		}
+	}
+	if ((minNZ < 1) || (maxNZ < minNZ)) {
+		Usage();
+		return 2;
+	}
+	if (families.empty()) {
+		for (family = 0; family < GEN_FAMILYCOUNT; family++) {
+			families.push_back(family);
+		}
+	}
+	if (csvFile) {
+		fp = fopen(csvFile, "w");
+		if (!fp) {
+			fprintf(stderr, "Cannot open %s\n", csvFile);
+			return 2;
+		}
+	}
+
+	CoinInitSolver("");
+	fprintf(fp, "%s\n", CSV_HEADER);
+	for (i = 0; i < families.size(); i++) {
+		ScaleResult prev;
+		bool havePrev = false;
+
+		/* Sizes grow by a factor of ten from minnz up to maxnz */
+		for (targetNZ = minNZ; targetNZ <= maxNZ; targetNZ *= 10) {
+			GenModel model;
+			ScaleResult result;
+
+			if (!GenerateModel(families[i], targetNZ, seed, model)) {
+				continue;
+			}
+			if (!RunScaleModel(model, timeLimit, result)) {
+				continue;
+			}
+			fprintf(stderr, "%-14s nz %9d store %9.4fs load %9.4fs solve %9.4fs results %9.4fs\n",
+					result.family.c_str(), result.nzCount, result.storeTime, result.loadTime,
+					result.solveTime, result.resultsTime);
+			WriteCsvLine(fp, result, havePrev ? &prev : NULL);
+			fflush(fp);
+			prev = result;
+			havePrev = true;
+		}
+	}
+	CoinFreeSolver();
+
+	if (csvFile) {
+		fclose(fp);
+	}
+	return 0;
+}
@@ -44,6 +44,22 @@ int SOLVCALL MipNodeCallback(int     iterCount,
 }
 
 
+static int mipSolutionCount;
+
+int SOLVCALL MipSolutionCallback(int     nodeCount,
+								 double  objectValue,
+								 int     colCount,
+								 const double* colValues,
+								 void   *userParam)
+{
+	fprintf(stdout, "*** SolutionCB: node=%d, obj=%.12g, cols=%d\n",
+					nodeCount, objectValue, colCount);
+	assert(colValues != NULL);
+	mipSolutionCount++;
+	return 0;
+}
+
+
 void GetAndCheckSolution(double optimalValue, HPROB hProb)
 {
 	int solutionStatus;
@@ -52,6 +68,11 @@ void GetAndCheckSolution(double optimalValue, HPROB hProb)
 	int i;
 	int colCount;
 	double* xValues;
+	int nzCount, nzTotal;
+	int* nzIndex;
+	int solutionCount;
+	double poolValue, foundTime;
+	double* nzValues;
 	const char* ColName;
 	const char* problemName;
 
@@ -77,6 +98,48 @@ void GetAndCheckSolution(double optimalValue, HPROB hProb)
 		}
 	}
 	fprintf(stdout, "---------------------------------------\n\n");
+	nzIndex = (int* )malloc(colCount * sizeof(int));
+	nzValues = (double* )malloc(colCount * sizeof(double));
+	nzCount = CoinGetNonzeroColValues(hProb, 0.0, colCount, nzIndex, nzValues);
+	nzTotal = nzCount;
+	for (i = 0; i < nzCount; i++) {
+		assert(nzValues[i] == xValues[nzIndex[i]]);
+	}
+	for (i = 0; i < colCount; i++) {
+		nzCount -= (xValues[i] != 0.0);
+	}
+	assert(nzCount == 0);
+	/* a MaxCount below the count still returns the count */
+	if (nzTotal > 1) {
+		nzIndex[1] = -1;
+		assert(CoinGetNonzeroColValues(hProb, 0.0, 1, nzIndex, nzValues) == nzTotal);
+		assert(nzValues[0] == xValues[nzIndex[0]]);
+		assert(nzIndex[1] == -1);
+	}
+	/* indexed columns in reverse order, an index out of range fails */
+	for (i = 0; i < colCount; i++) {
+		nzIndex[i] = colCount - 1 - i;
+	}
+	assert(CoinGetColValues(hProb, colCount, nzIndex, nzValues) == SOLV_CALL_SUCCESS);
+	for (i = 0; i < colCount; i++) {
+		assert(nzValues[i] == xValues[colCount - 1 - i]);
+	}
+	nzIndex[0] = colCount;
+	assert(CoinGetColValues(hProb, 1, nzIndex, nzValues) == SOLV_CALL_FAILED);
+	nzIndex[0] = -1;
+	assert(CoinGetColValues(hProb, 1, nzIndex, nzValues) == SOLV_CALL_FAILED);
+	free(nzIndex);
+	free(nzValues);
+	/* the best pool solution is the returned solution */
+	solutionCount = CoinGetSolutionCount(hProb);
+	for (i = 0; i < solutionCount; i++) {
+		CoinGetSolutionValuesN(hProb, i, NULL, &poolValue, &foundTime);
+		fprintf(stdout, "Pool solution %d: obj=%.12g time=%.3f\n", i, poolValue, foundTime);
+		if (i == 0) {
+			assert( fabs(poolValue-objectValue) < 0.001 );
+		}
+	}
+	free(xValues);
 	assert(solutionStatus==0);
 	assert(strcmp(solutionText,"Optimal solution found")==0);
 	if (optimalValue != 0.0) {
@@ -116,8 +179,13 @@ void RunTestProblem(const char* problemName, double optimalValue, int colCount,
 		result = CoinRegisterLPIterCallback(hProb, &IterCallback, (void*)userParam);
 	else {
 		result = CoinRegisterMipNodeCallback(hProb, &MipNodeCallback, (void*)userParam);
+		result = CoinRegisterMipSolutionCallback(hProb, &MipSolutionCallback, (void*)userParam);
 	}
+	mipSolutionCount = 0;
 	result = CoinOptimizeProblem(hProb, 0);
+	if (columnType) {
+		assert(mipSolutionCount > 0);
+	}
 	strcpy(filename, problemName);
 	strcat(filename, ".mps");
 	result = CoinWriteFile(hProb, SOLV_FILE_MPS, filename);
@@ -191,6 +259,7 @@ void RunTestProblemMip(const char* problemName, double optimalValue, int colCoun
 	}
 	if (priorCount > 0) {
 		result = CoinLoadPriority(hProb, priorCount, priorIndex, priorValues, priorBranch);
+		assert(result == SOLV_CALL_SUCCESS);
 	}
 	if (sosCount > 0) {
 		result = CoinLoadSos(hProb, sosCount, sosNZCount, sosType, sosPrior, sosBegin, sosIndex, sosRef);
@@ -470,11 +539,23 @@ void SolveProblemExmip1(void)
 
 	char ctyp[8] = { 'C', 'C', 'B', 'B', 'C', 'C', 'C', 'C'};
 
+	/* branch down on col04 first, then up on col03 */
+	int priorCount = 2;
+	int priorIndex[2] = {2, 3};
+	int priorValues[2] = {2, 1};
+	int priorBranch[2] = {1, -1};
+
 	double optimalValue = 3.23684210526;
 
 	RunTestProblem(probname, optimalValue, ncol, nrow, nels, nrng,
 	  objsens, objconst, dobj, dclo, dcup, rtyp, drhs, drng, mbeg, 
 	  mcnt, midx, mval, const_cast<char**>(colnames), const_cast<char**>(rownames), objectname, NULL, ctyp);
+
+	RunTestProblemMip(probname, optimalValue, ncol, nrow, nels, nrng,
+	  objsens, objconst, dobj, dclo, dcup, rtyp, drhs, drng, mbeg, 
+	  mcnt, midx, mval, const_cast<char**>(colnames), const_cast<char**>(rownames), objectname, NULL, ctyp,
+	  0, 0, NULL, NULL, NULL, NULL, NULL, 0, NULL,
+	  priorCount, priorIndex, priorValues, priorBranch);
 }
 
 
@@ -522,9 +603,10 @@ void SolveProblemGamsSos1a(void)
 }
 
 
-void SolveProblemGamsSos2a(void)
+/* The SOS2 set interpolates x over the breakpoints 1, 2 and 3, the
+   reference weights and priority are optional */
+void RunGamsSos2a(const char* probname, int* sosPrior, double* sosRef)
 {
-	const char* probname = "GamsSos2a";
 	int ncol = 7;
 	int nrow = 5;
 	int nels = 15;
@@ -560,11 +642,27 @@ void SolveProblemGamsSos2a(void)
 	RunTestProblemMip(probname, optimalValue, ncol, nrow, nels, nrng,
 	  objsens, objconst, dobj, dclo, dcup, rtyp, drhs, NULL, mbeg, 
 	  mcnt, midx, mval, const_cast<char**>(colnames), const_cast<char**>(rownames), objectname, NULL, NULL,
-	  sosCount, sosNZCount, sosType, NULL, sosBegin, sosIndex, NULL,
+	  sosCount, sosNZCount, sosType, sosPrior, sosBegin, sosIndex, sosRef,
 	  0, NULL, 0, NULL, NULL, NULL);
 }
 
 
+void SolveProblemGamsSos2a(void)
+{
+	RunGamsSos2a("GamsSos2a", NULL, NULL);
+}
+
+
+/* Same set branched on the breakpoints as reference weights */
+void SolveProblemGamsSos2aRef(void)
+{
+	int sosPrior[1] = {1};
+	double sosRef[3] = {1, 2, 3};
+
+	RunGamsSos2a("GamsSos2aRef", sosPrior, sosRef);
+}
+
+
 void SolveProblemSemiCont(void)
 {
 	const char* probname = "SemiCont";
@@ -605,6 +703,512 @@ void SolveProblemSemiCont(void)
 }
 
 
+void SolveProblemRowSlack(void)
+{
+	const char* probname = "RowSlack";
+	int ncol = 2;
+	int nrow = 5;
+	int nels = 9;
+	int nrng = 1;
+	
+	const char* objectname = "z";
+	int objsens = SOLV_OBJSENS_MIN;
+	double objconst = 0.0;
+	double dobj[2]={1.0, 1.0};
+
+	double dclo[2]={0.0, 0.0};
+	double dcup[2]={10.0, 10.0};
+
+	char rtyp[5]= {'L', 'G', 'E', 'R', 'N'};
+	double drhs[5]={8.0, 4.0, 3.0, 6.0, 0.0};
+	double drng[5]={0.0, 0.0, 0.0, 2.0, 0.0};
+
+	int mbeg[2+1]={0, 4, 9};
+	int mcnt[2]={4, 5};
+	int midx[9]={0, 1, 3, 4, 0, 1, 2, 3, 4};
+	double mval[9]={1, 1, 1, 1, 1, 2, 1, 1, -1};
+
+	const char* colnames[2] = {"x", "y"};
+	const char* rownames[5] = {"cap", "demand", "fixy", "band", "diff"};
+
+	/* x = 1, y = 3: distance to the bound for 'L' and 'G' rows, the nearest
+	   bound for the range row 4 <= x+y <= 6, none for the free row */
+	double optimalValue = 4.0;
+	double expectSlack[5]={4.0, 3.0, 0.0, 0.0, 0.0};
+	double expectActivity[5]={4.0, 7.0, 3.0, 4.0, -2.0};
+
+	HPROB hProb;
+	double slackValues[5];
+	int rowIndex[5] = {4, 0, 2, -1, -1};
+	double rowValues[5];
+	const double* slackView;
+	const double* activityView;
+	int i;
+
+	RunTestProblem(probname, optimalValue, ncol, nrow, nels, nrng,
+	  objsens, objconst, dobj, dclo, dcup, rtyp, drhs, drng, mbeg, 
+	  mcnt, midx, mval, const_cast<char**>(colnames), const_cast<char**>(rownames), objectname, NULL, NULL);
+
+	hProb = CoinCreateProblem(probname);  
+	CoinLoadMatrix(hProb, ncol, nrow, nels, nrng, objsens, objconst, dobj, dclo, dcup, 
+					rtyp, drhs, drng, mbeg, mcnt, midx, mval);
+	CoinOptimizeProblem(hProb, 0);
+	CoinGetSolutionValues(hProb, NULL, NULL, slackValues, NULL);
+	for (i = 0; i < nrow; i++) {
+		fprintf(stdout, "%s slack = %.12g\n", rownames[i], slackValues[i]);
+		assert( fabs(slackValues[i]-expectSlack[i]) < 0.001 );
+	}
+	/* indexed row activities, an index out of range fails */
+	assert(CoinGetRowValues(hProb, 3, rowIndex, rowValues) == SOLV_CALL_SUCCESS);
+	for (i = 0; i < 3; i++) {
+		assert( fabs(rowValues[i]-expectActivity[rowIndex[i]]) < 0.001 );
+	}
+	rowIndex[0] = nrow;
+	assert(CoinGetRowValues(hProb, 1, rowIndex, rowValues) == SOLV_CALL_FAILED);
+	/* all five rows are nonzero, only the first two are stored */
+	rowIndex[2] = -1;
+	assert(CoinGetNonzeroRowValues(hProb, 0.0, 2, rowIndex, rowValues) == nrow);
+	assert(rowIndex[0] == 0 && rowIndex[1] == 1 && rowIndex[2] == -1);
+	assert( fabs(rowValues[1]-expectActivity[1]) < 0.001 );
+	/* cap, demand and band are above 3.5 */
+	assert(CoinGetNonzeroRowValues(hProb, 3.5, nrow, rowIndex, rowValues) == 3);
+	assert(rowIndex[0] == 0 && rowIndex[1] == 1 && rowIndex[2] == 3);
+	/* same values through the arrays of the solver object */
+	CoinSetIntOption(hProb, COIN_INT_SOLUTIONVIEW, 1);
+	CoinOptimizeProblem(hProb, 0);
+	slackView = CoinGetSolutionPtr(hProb, SOLV_VALUES_SLACK);
+	activityView = CoinGetSolutionPtr(hProb, SOLV_VALUES_ACTIVITY);
+	assert(slackView && activityView);
+	assert( fabs(activityView[0]-1.0) < 0.001 && fabs(activityView[1]-3.0) < 0.001 );
+	for (i = 0; i < nrow; i++) {
+		assert( fabs(slackView[i]-expectSlack[i]) < 0.001 );
+	}
+	CoinUnloadProblem(hProb);
+}
+
+
+/* Two integer columns 0 <= x, y <= 10 and the objective max x + y over
+   the single row rowCoeff * (x + y) <= 15, shared by the callback tests */
+HPROB LoadTwoColumnMip(const char* probname, double rowCoeff)
+{
+	int ncol = 2;
+	int nrow = 1;
+	int nels = 2;
+
+	double dobj[2]={1.0, 1.0};
+	double dclo[2]={0.0, 0.0};
+	double dcup[2]={10.0, 10.0};
+	char ctyp[3]= "II";
+
+	char rtyp[1]= {'L'};
+	double drhs[1]={15.0};
+
+	int mbeg[2+1]={0, 1, 2};
+	int mcnt[2]={1, 1};
+	int midx[2]={0, 0};
+	double mval[2];
+
+	HPROB hProb;
+
+	mval[0] = rowCoeff;
+	mval[1] = rowCoeff;
+	hProb = CoinCreateProblem(probname);
+	CoinLoadMatrix(hProb, ncol, nrow, nels, 0, SOLV_OBJSENS_MAX, 0.0, dobj, dclo, dcup,
+					rtyp, drhs, NULL, mbeg, mcnt, midx, mval);
+	CoinLoadInteger(hProb, ctyp);
+	return hProb;
+}
+
+
+/* Lazy row x <= 4, the core model only has x + y <= 15 */
+int SOLVCALL LazyConCallback(int     colCount,
+							 const double* colValues,
+							 double  objectValue,
+							 HCUTS   hCuts,
+							 void   *userParam)
+{
+	int cutIndex[1] = {0};
+	double cutValue[1] = {1.0};
+	int badIndex[1] = {2};
+
+	assert(colCount == 2);
+	assert(CoinAddCut(hCuts, 1, badIndex, cutValue, -1e+37, 4.0) == SOLV_CALL_FAILED);
+	if (colValues[0] > 4.5) {
+		(*(int*)userParam)++;
+		CoinAddCut(hCuts, 1, cutIndex, cutValue, -1e+37, 4.0);
+	}
+	return 0;
+}
+
+
+void SolveProblemLazyCons(void)
+{
+	const char* probname = "LazyCons";
+	HPROB hProb;
+	double activity[2];
+	int lazyCount = 0;
+
+	hProb = LoadTwoColumnMip(probname, 1.0);
+	CoinRegisterLazyConstraintCallback(hProb, &LazyConCallback, &lazyCount);
+	CoinOptimizeProblem(hProb, 0);
+	CoinGetSolutionValues(hProb, activity, NULL, NULL, NULL);
+	fprintf(stdout, "%s: obj=%.12g, x=%.12g, y=%.12g, lazy cuts=%d\n", probname,
+					CoinGetObjectValue(hProb), activity[0], activity[1], lazyCount);
+	assert(lazyCount > 0);
+	assert( fabs(CoinGetObjectValue(hProb)-14.0) < 0.001 );
+	assert( activity[0] < 4.001 );
+	CoinUnloadProblem(hProb);
+}
+
+
+/* Rounding cut x + y <= 7 for the row 2x + 2y <= 15 */
+int SOLVCALL UserCutCallback(int     colCount,
+							 const double* colValues,
+							 double  objectValue,
+							 int     nodeDepth,
+							 HCUTS   hCuts,
+							 void   *userParam)
+{
+	int cutIndex[2] = {0, 1};
+	double cutValue[2] = {1.0, 1.0};
+
+	assert(colCount == 2);
+	(*(int*)userParam)++;
+	if (colValues[0] + colValues[1] > 7.001) {
+		CoinAddCut(hCuts, 2, cutIndex, cutValue, -1e+37, 7.0);
+	}
+	return 0;
+}
+
+
+void SolveProblemUserCuts(void)
+{
+	const char* probname = "UserCuts";
+	HPROB hProb;
+	int separateCount = 0;
+
+	hProb = LoadTwoColumnMip(probname, 2.0);
+	CoinRegisterUserCutCallback(hProb, &UserCutCallback, &separateCount);
+	CoinOptimizeProblem(hProb, 0);
+	fprintf(stdout, "%s: obj=%.12g, separator calls=%d\n", probname,
+					CoinGetObjectValue(hProb), separateCount);
+	assert(separateCount > 0);
+	assert( fabs(CoinGetObjectValue(hProb)-7.0) < 0.001 );
+	CoinUnloadProblem(hProb);
+}
+
+
+/* Feasible and optimal x = 3, y = 4 for the row 2x + 2y <= 15 */
+int SOLVCALL HeuristicCallback(int     nodeCount,
+							   int     colCount,
+							   const double* colValues,
+							   double *newColValues,
+							   void   *userParam)
+{
+	assert(colCount == 2);
+	(*(int*)userParam)++;
+	newColValues[0] = 3.0;
+	newColValues[1] = 4.0;
+	return 1;
+}
+
+
+/* Keeps the first solution reported by the search */
+int SOLVCALL FirstSolutionCallback(int     nodeCount,
+								   double  objectValue,
+								   int     colCount,
+								   const double* colValues,
+								   void   *userParam)
+{
+	double* firstSolution = (double*)userParam;
+
+	assert(colCount == 2);
+	if (mipSolutionCount++ == 0) {
+		firstSolution[0] = colValues[0];
+		firstSolution[1] = colValues[1];
+	}
+	return 0;
+}
+
+
+void SolveProblemHeuristic(void)
+{
+	const char* probname = "Heuristic";
+	HPROB hProb;
+	double activity[2];
+	double firstSolution[2] = {-1.0, -1.0};
+	int heuristicCount = 0;
+
+	hProb = LoadTwoColumnMip(probname, 2.0);
+	/* without root cuts the root LP stays fractional, so the heuristic
+	   solution is the first incumbent */
+	CoinSetIntOption(hProb, COIN_INT_MIPMAXPASSROOT, 0);
+	CoinSetIntOption(hProb, COIN_INT_MIPMAXCUTPASS, 0);
+	CoinRegisterHeuristicCallback(hProb, &HeuristicCallback, &heuristicCount);
+	CoinRegisterMipSolutionCallback(hProb, &FirstSolutionCallback, firstSolution);
+	mipSolutionCount = 0;
+	CoinOptimizeProblem(hProb, 0);
+	CoinGetSolutionValues(hProb, activity, NULL, NULL, NULL);
+	fprintf(stdout, "%s: obj=%.12g, x=%.12g, y=%.12g, heuristic calls=%d\n", probname,
+					CoinGetObjectValue(hProb), activity[0], activity[1], heuristicCount);
+	assert(heuristicCount > 0);
+	assert(mipSolutionCount > 0);
+	assert( fabs(firstSolution[0]-3.0) < 0.001 && fabs(firstSolution[1]-4.0) < 0.001 );
+	/* only a strictly better solution replaces the incumbent */
+	assert( fabs(CoinGetObjectValue(hProb)-7.0) < 0.001 );
+	assert( fabs(activity[0]-3.0) < 0.001 && fabs(activity[1]-4.0) < 0.001 );
+	CoinUnloadProblem(hProb);
+}
+
+
+/* Feasible x = 3, y = 0 for the row 2x + 2y <= 15, well below the optimum */
+int SOLVCALL PoolHeuristicCallback(int     nodeCount,
+								   int     colCount,
+								   const double* colValues,
+								   double *newColValues,
+								   void   *userParam)
+{
+	newColValues[0] = 3.0;
+	newColValues[1] = 0.0;
+	return 1;
+}
+
+
+void SolveProblemSolutionPool(void)
+{
+	const char* probname = "SolutionPool";
+	HPROB hProb;
+	double activity[2];
+	double poolValues[10][2];
+	double poolObjects[10];
+	double foundTime;
+	int solutionCount;
+	int hasHeuristic = 0;
+	int i, j;
+
+	hProb = LoadTwoColumnMip(probname, 2.0);
+	/* the heuristic solution is the first incumbent, branching then finds
+	   the optimum, so the pool holds at least two solutions */
+	CoinSetIntOption(hProb, COIN_INT_MIPMAXPASSROOT, 0);
+	CoinSetIntOption(hProb, COIN_INT_MIPMAXCUTPASS, 0);
+	CoinSetIntOption(hProb, COIN_INT_SOLUTIONPOOL, 10);
+	CoinRegisterHeuristicCallback(hProb, &PoolHeuristicCallback, NULL);
+	CoinOptimizeProblem(hProb, 0);
+	solutionCount = CoinGetSolutionCount(hProb);
+	fprintf(stdout, "%s: obj=%.12g, pool solutions=%d\n", probname,
+					CoinGetObjectValue(hProb), solutionCount);
+	assert(solutionCount > 1 && solutionCount <= 10);
+	for (i = 0; i < solutionCount; i++) {
+		assert(CoinGetSolutionValuesN(hProb, i, activity, &poolObjects[i], &foundTime) == SOLV_CALL_SUCCESS);
+		fprintf(stdout, "Pool solution %d: obj=%.12g x=%.12g y=%.12g\n", i, poolObjects[i],
+						activity[0], activity[1]);
+		assert( fabs(poolObjects[i]-(activity[0]+activity[1])) < 0.001 );
+		poolValues[i][0] = activity[0];
+		poolValues[i][1] = activity[1];
+		hasHeuristic |= (fabs(activity[0]-3.0) < 0.001) && (fabs(activity[1]) < 0.001);
+	}
+	assert( fabs(poolObjects[0]-7.0) < 0.001 );
+	assert(hasHeuristic);
+	/* best first for the maximization and no solution twice */
+	for (i = 1; i < solutionCount; i++) {
+		assert(poolObjects[i] <= poolObjects[i-1]);
+		for (j = 0; j < i; j++) {
+			assert((poolValues[i][0] != poolValues[j][0]) || (poolValues[i][1] != poolValues[j][1]));
+		}
+	}
+	assert(CoinGetSolutionValuesN(hProb, solutionCount, activity, NULL, NULL) == SOLV_CALL_FAILED);
+
+	/* a 10% gap keeps only the solutions with objective 7 */
+	CoinSetRealOption(hProb, COIN_REAL_SOLUTIONPOOLGAP, 0.1);
+	CoinOptimizeProblem(hProb, 0);
+	solutionCount = CoinGetSolutionCount(hProb);
+	fprintf(stdout, "%s: pool solutions within gap=%d\n", probname, solutionCount);
+	assert(solutionCount > 0);
+	for (i = 0; i < solutionCount; i++) {
+		CoinGetSolutionValuesN(hProb, i, NULL, &poolObjects[i], NULL);
+		assert( fabs(poolObjects[i]-7.0) < 0.001 );
+	}
+	CoinUnloadProblem(hProb);
+}
+
+
+void SolveProblemQuadratic(void)
+{
+	const char* probname = "Quadratic";
+	int ncol = 2;
+	int nrow = 1;
+	int nels = 2;
+
+	/* min x^2 + y^2 - y, x + y >= 2 */
+	double dobj[2]={0.0, -1.0};
+	double dclo[2]={0.0, 0.0};
+	double dcup[2]={10.0, 10.0};
+
+	char rtyp[1]= {'G'};
+	double drhs[1]={2.0};
+
+	int mbeg[2+1]={0, 1, 2};
+	int mcnt[2]={1, 1};
+	int midx[2]={0, 0};
+	double mval[2]={1, 1};
+
+	int qbeg[2+1]={0, 1, 2};
+	int qidx[2]={0, 1};
+	double qval[2]={2.0, 2.0};
+
+	HPROB hProb;
+	double activity[2];
+	int result;
+
+	assert(CoinGetFeatures() & SOLV_FEATURE_QP);
+	hProb = CoinCreateProblem(probname);
+	CoinLoadMatrix(hProb, ncol, nrow, nels, 0, SOLV_OBJSENS_MIN, 0.0, dobj, dclo, dcup,
+					rtyp, drhs, NULL, mbeg, mcnt, midx, mval);
+	result = CoinLoadQuadratic(hProb, qbeg, NULL, qidx, qval);
+	assert(result == SOLV_CALL_SUCCESS);
+	CoinOptimizeProblem(hProb, 0);
+	CoinGetSolutionValues(hProb, activity, NULL, NULL, NULL);
+	fprintf(stdout, "%s: obj=%.12g, x=%.12g, y=%.12g\n", probname,
+					CoinGetObjectValue(hProb), activity[0], activity[1]);
+	assert( fabs(activity[0]-0.75) < 0.001 );
+	assert( fabs(activity[1]-1.25) < 0.001 );
+	assert( fabs(CoinGetObjectValue(hProb)-0.875) < 0.001 );
+	CoinUnloadProblem(hProb);
+}
+
+
+void SolveProblemBenders(void)
+{
+	const char* probname = "Benders";
+	int ncol = 3;
+	int nrow = 4;
+	int nels = 6;
+
+	/* capacity x is bought first, each scenario then produces y <= x
+	   to meet its demand: min x + 0.5 y1 + 0.5 y2, y1 >= 3, y2 >= 5 */
+	double dobj[3]={1.0, 0.5, 0.5};
+	double dclo[3]={0.0, 0.0, 0.0};
+	double dcup[3]={10.0, 10.0, 10.0};
+
+	char rtyp[4]= {'L', 'G', 'L', 'G'};
+	double drhs[4]={0.0, 3.0, 0.0, 5.0};
+
+	int mbeg[3+1]={0, 2, 4, 6};
+	int mcnt[3]={2, 2, 2};
+	int midx[6]={0, 2, 0, 1, 2, 3};
+	double mval[6]={-1, -1, 1, 1, 1, 1};
+
+	int colBlock[3]={0, 1, 2};
+	int rowBlock[4]={1, 1, 2, 2};
+
+	HPROB hProb;
+	COIN_SOLVESTATS stats;
+	double activity[3];
+	int lazyCount = 0;
+	int result;
+
+	hProb = CoinCreateProblem(probname);
+	CoinLoadMatrix(hProb, ncol, nrow, nels, 0, SOLV_OBJSENS_MIN, 0.0, dobj, dclo, dcup,
+					rtyp, drhs, NULL, mbeg, mcnt, midx, mval);
+	rowBlock[0] = 3;
+	result = CoinLoadBlocks(hProb, 2, colBlock, rowBlock);
+	assert(result == SOLV_CALL_FAILED);
+	rowBlock[0] = 1;
+	result = CoinLoadBlocks(hProb, 2, colBlock, rowBlock);
+	assert(result == SOLV_CALL_SUCCESS);
+	CoinSetIntOption(hProb, COIN_INT_BENDERSTHREADS, 2);
+	result = CoinOptimizeProblem(hProb, SOLV_METHOD_BENDERS);
+	assert(result == SOLV_CALL_SUCCESS);
+	CoinGetSolutionValues(hProb, activity, NULL, NULL, NULL);
+	fprintf(stdout, "%s: %s, obj=%.12g, x=%.12g, y1=%.12g, y2=%.12g\n", probname,
+					CoinGetSolutionText(hProb), CoinGetObjectValue(hProb),
+					activity[0], activity[1], activity[2]);
+	assert(CoinGetSolutionStatus(hProb) == 0);
+	assert(strcmp(CoinGetSolutionText(hProb), "Optimal solution found") == 0);
+	assert( fabs(activity[0]-5.0) < 0.001 );
+	assert( fabs(CoinGetObjectValue(hProb)-9.0) < 0.001 );
+	CoinGetSolveStats(hProb, &stats);
+	assert(stats.BendersIterCount > 0);
+
+	CoinOptimizeProblem(hProb, 0);
+	assert( fabs(CoinGetObjectValue(hProb)-9.0) < 0.001 );
+
+	/* the decomposition would not call the lazy constraint callback */
+	CoinRegisterLazyConstraintCallback(hProb, &LazyConCallback, &lazyCount);
+	result = CoinOptimizeProblem(hProb, SOLV_METHOD_BENDERS);
+	assert(result == SOLV_CALL_FAILED);
+	CoinUnloadProblem(hProb);
+}
+
+
+void SolveProblemScenarios(void)
+{
+	const char* probname = "Scenarios";
+	int ncol = 2;
+	int nrow = 2;
+	int nels = 3;
+
+	/* capacity x is bought first, production y <= x then meets the demand
+	   of the scenario: min x + 0.5 y, y >= 3 or y >= 5 with equal odds */
+	double dobj[2]={1.0, 0.5};
+	double dclo[2]={0.0, 0.0};
+	double dcup[2]={10.0, 10.0};
+
+	char rtyp[2]= {'L', 'G'};
+	double drhs[2]={0.0, 4.0};
+
+	int mbeg[2+1]={0, 1, 3};
+	int mcnt[2]={1, 2};
+	int midx[3]={0, 0, 1};
+	double mval[3]={-1, 1, 1};
+
+	int colBlock[2]={0, 1};
+	int rowBlock[2]={1, 1};
+
+	int rhsBeg[2+1]={0, 1, 2};
+	int rhsIdx[2]={1, 1};
+	double rhsVal[2]={3.0, 5.0};
+	double prob[2]={0.5, 0.6};
+
+	HPROB hProb;
+	double activity[2];
+	int result;
+
+	hProb = CoinCreateProblem(probname);
+	CoinLoadMatrix(hProb, ncol, nrow, nels, 0, SOLV_OBJSENS_MIN, 0.0, dobj, dclo, dcup,
+					rtyp, drhs, NULL, mbeg, mcnt, midx, mval);
+	CoinLoadBlocks(hProb, 1, colBlock, rowBlock);
+	result = CoinLoadScenarios(hProb, 2, prob, rhsBeg, rhsIdx, rhsVal, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	assert(result == SOLV_CALL_FAILED);
+	prob[1] = 0.5;
+	result = CoinLoadScenarios(hProb, 2, prob, rhsBeg, rhsIdx, rhsVal, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	assert(result == SOLV_CALL_SUCCESS);
+
+	result = CoinOptimizeProblem(hProb, SOLV_METHOD_DEQ);
+	assert(result == SOLV_CALL_SUCCESS);
+	CoinGetSolutionValues(hProb, activity, NULL, NULL, NULL);
+	fprintf(stdout, "%s: %s, obj=%.12g, x=%.12g, y=%.12g\n", probname,
+					CoinGetSolutionText(hProb), CoinGetObjectValue(hProb),
+					activity[0], activity[1]);
+	assert(CoinGetSolutionStatus(hProb) == 0);
+	assert( fabs(activity[0]-5.0) < 0.001 );
+	assert( fabs(activity[1]-3.0) < 0.001 );
+	assert( fabs(CoinGetObjectValue(hProb)-7.0) < 0.001 );
+	result = CoinGetScenarioValues(hProb, 1, activity, NULL, NULL, NULL);
+	assert(result == SOLV_CALL_SUCCESS);
+	assert( fabs(activity[0]-5.0) < 0.001 );
+	assert( fabs(activity[1]-5.0) < 0.001 );
+
+	/* the expected demand of 4 needs less capacity */
+	result = CoinOptimizeProblem(hProb, SOLV_METHOD_EV);
+	assert(result == SOLV_CALL_SUCCESS);
+	assert( fabs(CoinGetObjectValue(hProb)-6.0) < 0.001 );
+	result = CoinGetScenarioValues(hProb, 1, activity, NULL, NULL, NULL);
+	assert(result == SOLV_CALL_FAILED);
+	CoinUnloadProblem(hProb);
+}
+
+
 int main (int argc, char* argv[])
 {
 	const char* SolverName;
@@ -621,7 +1225,16 @@ int main (int argc, char* argv[])
 	SolveProblemExmip1();
 	SolveProblemGamsSos1a();
 	SolveProblemGamsSos2a();
+	SolveProblemGamsSos2aRef();
 	SolveProblemSemiCont();
+	SolveProblemRowSlack();
+	SolveProblemLazyCons();
+	SolveProblemUserCuts();
+	SolveProblemHeuristic();
+	SolveProblemSolutionPool();
+	SolveProblemQuadratic();
+	SolveProblemBenders();
+	SolveProblemScenarios();
 	fprintf(stdout, "All unit tests completed successfully\n" );
 	CoinFreeSolver();
 	return 0;